@@ -6,6 +6,7 @@
 #include "Components/GSCCoreComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
 
 void UGSCAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
@@ -34,6 +35,9 @@ void UGSCAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, f
 
 void UGSCAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_PostGameplayEffectExecute);
+	GSC_INC_COUNTER(STAT_GSC_NumEffectExecutions);
+
     Super::PostGameplayEffectExecute(Data);
 
 	FGSCAttributeSetExecutionData ExecutionData;
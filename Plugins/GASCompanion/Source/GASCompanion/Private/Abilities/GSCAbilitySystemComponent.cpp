@@ -9,9 +9,85 @@
 #include "Components/GSCAbilityQueueComponent.h"
 #include "Components/GSCComboManagerComponent.h"
 #include "Components/GSCCoreComponent.h"
+#include "GameFeatureAction.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerState.h"
 #include "Animations/GSCNativeAnimInstanceInterface.h"
+#include "Core/Debug/GSCInputLatencyTracker.h"
+#include "Core/Debug/GSCMemoryReport.h"
+#include "Core/Debug/GSCTrace.h"
+#include "Engine/World.h"
+#include "GSCDelegates.h"
+#include "HAL/IConsoleManager.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
+#include "Subsystems/GSCPawnControllerSubsystem.h"
+
+namespace GSCAbilitySystemComponent_Impl
+{
+	static int32 bMultiplexSyncPoints = 0;
+	static FAutoConsoleVariableRef CVarMultiplexSyncPoints(
+		TEXT("GASCompanion.NetSync.Multiplex"),
+		bMultiplexSyncPoints,
+		TEXT("Send GAS Companion network sync points through a per ASC channel, batching all signals of a frame in one RPC (0 = off, 1 = on)"),
+		ECVF_Default
+	);
+
+	/** Rough size estimate of a standalone Server/ClientSetReplicatedEvent RPC function header, used to report bytes saved */
+	constexpr int32 EstimatedRPCOverheadBytes = 6;
+
+	/** Upper bound of signals sent in a single sync channel RPC, larger batches are split (and rejected by ServerSetSyncPointSignals_Validate) */
+	constexpr int32 MaxSyncPointSignalsPerRPC = 64;
+
+	struct FSyncChannelStats
+	{
+		int64 NumSignals = 0;
+		int64 NumRPCs = 0;
+
+		int64 GetRPCsSaved() const
+		{
+			return NumSignals - NumRPCs;
+		}
+
+		int64 GetEstimatedBytesSaved() const
+		{
+			return GetRPCsSaved() * EstimatedRPCOverheadBytes;
+		}
+	};
+
+	static FSyncChannelStats SyncChannelStats;
+
+	static FAutoConsoleCommand SyncStatsCommand(
+		TEXT("GASCompanion.NetSync.Stats"),
+		TEXT("Prints the number of sync point signals sent through the multiplexed sync channel, and RPCs / bytes (estimated) saved"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			Ar.Logf(
+				TEXT("GAS Companion sync channel: %lld signals sent in %lld RPCs, %lld RPCs saved (~%lld bytes, %d bytes overhead per RPC assumed)"),
+				SyncChannelStats.NumSignals,
+				SyncChannelStats.NumRPCs,
+				SyncChannelStats.GetRPCsSaved(),
+				SyncChannelStats.GetEstimatedBytesSaved(),
+				EstimatedRPCOverheadBytes
+			);
+		})
+	);
+
+	static FAutoConsoleCommand SyncStatsResetCommand(
+		TEXT("GASCompanion.NetSync.ResetStats"),
+		TEXT("Resets the multiplexed sync channel stats"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			SyncChannelStats = FSyncChannelStats();
+		})
+	);
+
+	/** Returns whether an ability or effect source object is a Game Feature action, which grants them again to new actors */
+	static bool IsGrantedByGameFeature(const UObject* SourceObject)
+	{
+		return SourceObject && SourceObject->IsA<UGameFeatureAction>();
+	}
+}
 
 void UGSCAbilitySystemComponent::BeginPlay()
 {
@@ -20,27 +96,34 @@ void UGSCAbilitySystemComponent::BeginPlay()
 	AbilityActivatedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityActivatedCallback);
 	AbilityFailedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityFailedCallback);
 	AbilityEndedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityEndedCallback);
+	AbilityCommittedCallbacks.AddUObject(this, &UGSCAbilitySystemComponent::OnAbilityCommittedCallback);
 
 	// Grant startup effects on begin play instead of from within InitAbilityActorInfo to avoid
 	// "ticking" periodic effects when BP is first opened
 	GrantStartupEffects();
 }
 
+void UGSCAbilitySystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromPawnControllerSubsystem();
+	Super::EndPlay(EndPlayReason);
+}
+
 void UGSCAbilitySystemComponent::BeginDestroy()
 {
 	// Reset ...
 
-	// Clear any delegate handled bound previously for this component
-	if (AbilityActorInfo && AbilityActorInfo->OwnerActor.IsValid())
-	{
-		if (UGameInstance* GameInstance = AbilityActorInfo->OwnerActor->GetGameInstance())
-		{
-			GameInstance->GetOnPawnControllerChanged().RemoveAll(this);
-		}
-	}
+	// Stop routing controller changes of owning pawn to this component
+	UnregisterFromPawnControllerSubsystem();
 
 	OnGiveAbilityDelegate.RemoveAll(this);
 
+	if (FlushSyncSignalsHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(FlushSyncSignalsHandle);
+		FlushSyncSignalsHandle.Reset();
+	}
+
 	// Remove any added attributes
 	for (UAttributeSet* AttribSetInstance : AddedAttributes)
 	{
@@ -48,8 +131,8 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	}
 
 
-	// Clear up abilities / bindings
-	UGSCAbilityInputBindingComponent* InputComponent = AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? AbilityActorInfo->AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+	// Clear up abilities / bindings (no input binding for crowd profile)
+	UGSCAbilityInputBindingComponent* InputComponent = !IsCrowdProfile() && AbilityActorInfo && AbilityActorInfo->AvatarActor.IsValid() ? AbilityActorInfo->AvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
 
 	for (const FGSCMappedAbility& DefaultAbilityHandle : DefaultAbilityHandles)
 	{
@@ -79,6 +162,7 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 
 void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor)
 {
+	LLM_SCOPE_BYTAG(GASCompanion);
 	Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
 
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::InitAbilityActorInfo() - Owner: %s, Avatar: %s"), *GetNameSafe(InOwnerActor), *GetNameSafe(InAvatarActor))
@@ -90,13 +174,14 @@ void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 			AbilityActorInfo->AnimInstance = AbilityActorInfo->GetAnimInstance();
 		}
 
-		if (UGameInstance* GameInstance = InOwnerActor->GetGameInstance())
+		// Sign up for possess / unpossess events of owning pawn so that we can update the cached AbilityActorInfo accordingly
+		//
+		// Crowd profile is for AI only actors, which don't need PlayerController in AbilityActorInfo to be kept up to date
+		APawn* OwnerPawn = Cast<APawn>(InOwnerActor);
+		UGSCPawnControllerSubsystem* PawnControllerSubsystem = OwnerPawn && !IsCrowdProfile() ? UGSCPawnControllerSubsystem::Get(OwnerPawn) : nullptr;
+		if (PawnControllerSubsystem)
 		{
-			// Sign up for possess / unpossess events so that we can update the cached AbilityActorInfo accordingly
-			if (!GameInstance->GetOnPawnControllerChanged().Contains(this, TEXT("OnPawnControllerChanged")))
-			{
-				GameInstance->GetOnPawnControllerChanged().AddDynamic(this, &UGSCAbilitySystemComponent::OnPawnControllerChanged);
-			}
+			PawnControllerSubsystem->RegisterAbilitySystem(OwnerPawn, this);
 		}
 
 		UAnimInstance* AnimInstance = AbilityActorInfo->GetAnimInstance();
@@ -126,11 +211,32 @@ void UGSCAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 	{
 		CoreComponent->OnInitAbilityActorInfo.Broadcast();
 	}
+
+	// Listened to by UI for lazy initialization and AGSCModularPlayerState (attribute activity for adaptive net update frequency).
+	// Crowds have no UI, and are AI only characters without Player States.
+	if (!IsCrowdProfile())
+	{
+		FGSCDelegates::OnAbilityActorInfoInitialized.Broadcast(this);
+	}
 }
 
 
+void UGSCAbilitySystemComponent::NotifyAbilityEnded(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, const bool bWasCancelled)
+{
+	// Triggered here instead of binding on each activation in UGSCGameplayAbility::PreActivate. Before Super, as the ability
+	// instance may be cleared right after end (RemoveAfterActivation)
+	if (UGSCGameplayAbility* CompanionAbility = Cast<UGSCGameplayAbility>(Ability))
+	{
+		CompanionAbility->AbilityEnded(Ability);
+	}
+
+	Super::NotifyAbilityEnded(Handle, Ability, bWasCancelled);
+}
+
 void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_AbilityLocalInputPressed);
+
 	// Consume the input if this InputID is overloaded with GenericConfirm/Cancel and the GenericConfim/Cancel callback is bound
 	if (IsGenericConfirmInputBound(InputID))
 	{
@@ -169,6 +275,8 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 				// Regardless of active or not active, always try to activate the combo. Combo Component will take care of gating activation or queuing next combo
 				if (IsValid(ComboComponent))
 				{
+					GSC_INPUT_LATENCY_MARK(MarkInputDispatched, this, InputID, Spec.Ability, true)
+
 					// We have a valid combo component, active combo
 					ComboComponent->ActivateComboAbility(Spec.Ability->GetClass());
 				}
@@ -180,6 +288,8 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 			else
 			{
 				// Ability is not a combo ability, go through normal workflow
+				GSC_INPUT_LATENCY_MARK(MarkInputDispatched, this, InputID, Spec.Ability, false)
+
 				if (Spec.IsActive())
 				{
 					if (Spec.Ability->bReplicateInputDirectly && IsOwnerActorAuthoritative() == false)
@@ -203,6 +313,7 @@ void UGSCAbilitySystemComponent::AbilityLocalInputPressed(const int32 InputID)
 
 FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::GrantAbility(const TSubclassOf<UGameplayAbility> Ability, const bool bRemoveAfterActivation)
 {
+	LLM_SCOPE_BYTAG(GASCompanion_Abilities);
 	FGameplayAbilitySpecHandle AbilityHandle;
 	if (!IsOwnerActorAuthoritative())
 	{
@@ -222,7 +333,11 @@ FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::GrantAbility(const TSubcl
 
 void UGSCAbilitySystemComponent::OnAbilityActivatedCallback(UGameplayAbility* Ability)
 {
+	GSC_INC_COUNTER(STAT_GSC_NumAbilityActivations);
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::OnAbilityActivatedCallback %s"), *Ability->GetName());
+	GSC_INPUT_LATENCY_MARK(MarkAbilityActivated, this, Ability)
+	GSC_TRACE_EVENT(AbilityActivated, GetAvatarActor(), Ability, Ability->GetCurrentActivationInfo().GetActivationPredictionKey(), 0)
+
 	const AActor* Avatar = GetAvatarActor();
 	if (!Avatar)
 	{
@@ -231,7 +346,7 @@ void UGSCAbilitySystemComponent::OnAbilityActivatedCallback(UGameplayAbility* Ab
 	}
 
 	const UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(Avatar);
-	if (CoreComponent)
+	if (CoreComponent && CoreComponent->OnAbilityActivated.IsBound())
 	{
 		CoreComponent->OnAbilityActivated.Broadcast(Ability);
 	}
@@ -239,7 +354,10 @@ void UGSCAbilitySystemComponent::OnAbilityActivatedCallback(UGameplayAbility* Ab
 
 void UGSCAbilitySystemComponent::OnAbilityFailedCallback(const UGameplayAbility* Ability, const FGameplayTagContainer& Tags)
 {
+	GSC_INC_COUNTER(STAT_GSC_NumAbilityFailures);
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::OnAbilityFailedCallback %s"), *Ability->GetName());
+	GSC_INPUT_LATENCY_MARK(MarkAbilityFailed, this, Ability)
+	GSC_TRACE_EVENT(AbilityFailed, GetAvatarActor(), Ability, ScopedPredictionKey, 0)
 
 	const AActor* Avatar = GetAvatarActor();
 	if (!Avatar)
@@ -248,9 +366,10 @@ void UGSCAbilitySystemComponent::OnAbilityFailedCallback(const UGameplayAbility*
 		return;
 	}
 
+	// Ability queue is driven by player input, not used with crowd profile
 	const UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(Avatar);
-	UGSCAbilityQueueComponent* AbilityQueueComponent = UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Avatar);
-	if (CoreComponent)
+	UGSCAbilityQueueComponent* AbilityQueueComponent = !IsCrowdProfile() ? UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Avatar) : nullptr;
+	if (CoreComponent && CoreComponent->OnAbilityFailed.IsBound())
 	{
 		CoreComponent->OnAbilityFailed.Broadcast(Ability, Tags);
 	}
@@ -261,9 +380,17 @@ void UGSCAbilitySystemComponent::OnAbilityFailedCallback(const UGameplayAbility*
 	}
 }
 
+void UGSCAbilitySystemComponent::OnAbilityCommittedCallback(UGameplayAbility* Ability)
+{
+	GSC_TRACE_EVENT(AbilityCommitted, GetAvatarActor(), Ability, Ability->GetCurrentActivationInfo().GetActivationPredictionKey(), 0)
+}
+
 void UGSCAbilitySystemComponent::OnAbilityEndedCallback(UGameplayAbility* Ability)
 {
+	GSC_INC_COUNTER(STAT_GSC_NumAbilityEnds);
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::OnAbilityEndedCallback %s"), *Ability->GetName());
+	GSC_TRACE_EVENT(AbilityEnded, GetAvatarActor(), Ability, Ability->GetCurrentActivationInfo().GetActivationPredictionKey(), 0)
+
 	const AActor* Avatar = GetAvatarActor();
 	if (!Avatar)
 	{
@@ -271,9 +398,10 @@ void UGSCAbilitySystemComponent::OnAbilityEndedCallback(UGameplayAbility* Abilit
 		return;
 	}
 
+	// Ability queue is driven by player input, not used with crowd profile
 	const UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(Avatar);
-	UGSCAbilityQueueComponent* AbilityQueueComponent = UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Avatar);
-	if (CoreComponent)
+	UGSCAbilityQueueComponent* AbilityQueueComponent = !IsCrowdProfile() ? UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Avatar) : nullptr;
+	if (CoreComponent && CoreComponent->OnAbilityEnded.IsBound())
 	{
 		CoreComponent->OnAbilityEnded.Broadcast(Ability);
 	}
@@ -310,8 +438,335 @@ bool UGSCAbilitySystemComponent::ShouldGrantAbility(const TSubclassOf<UGameplayA
 	return true;
 }
 
+bool UGSCAbilitySystemComponent::IsSyncChannelEnabled()
+{
+	return GSCAbilitySystemComponent_Impl::bMultiplexSyncPoints != 0;
+}
+
+SIZE_T UGSCAbilitySystemComponent::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = DefaultAbilityHandles.GetAllocatedSize();
+	AllocatedSize += AddedAttributes.GetAllocatedSize();
+	AllocatedSize += InputBindingDelegateHandles.GetAllocatedSize();
+	AllocatedSize += OnGiveAbilityDelegate.GetAllocatedSize();
+	AllocatedSize += OnSyncEventBatchReceived.GetAllocatedSize();
+	AllocatedSize += PendingServerSyncSignals.GetAllocatedSize();
+	AllocatedSize += PendingClientSyncSignals.GetAllocatedSize();
+	return AllocatedSize;
+}
+
+void UGSCAbilitySystemComponent::QueueSyncPointSignal(const EAbilityGenericReplicatedEvent::Type EventType, const FGameplayAbilitySpecHandle AbilityHandle, const FPredictionKey AbilityOriginalPredictionKey, const FPredictionKey CurrentPredictionKey)
+{
+	check(EventType == EAbilityGenericReplicatedEvent::GenericSignalFromClient || EventType == EAbilityGenericReplicatedEvent::GenericSignalFromServer);
+	LLM_SCOPE_BYTAG(GASCompanion);
+
+	FGSCNetSyncPointSignal Signal;
+	Signal.AbilityHandle = AbilityHandle;
+	Signal.AbilityOriginalPredictionKey = AbilityOriginalPredictionKey;
+	Signal.CurrentPredictionKey = CurrentPredictionKey;
+
+	if (EventType == EAbilityGenericReplicatedEvent::GenericSignalFromClient)
+	{
+		PendingServerSyncSignals.Add(Signal);
+	}
+	else
+	{
+		PendingClientSyncSignals.Add(Signal);
+	}
+
+	// Flush after actors have ticked, right before the net driver sends this frame's bunches
+	if (!FlushSyncSignalsHandle.IsValid())
+	{
+		FlushSyncSignalsHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UGSCAbilitySystemComponent::FlushSyncPointSignals);
+	}
+}
+
+bool UGSCAbilitySystemComponent::QueueSyncEventBatchSignal(const FGameplayAbilitySpecHandle AbilityHandle, const FPredictionKey AbilityOriginalPredictionKey, const FPredictionKey CurrentPredictionKey)
+{
+	// Join the pending batch of this ability, as long as it can hold one more event
+	if (PendingServerSyncSignals.Num() > 0)
+	{
+		FGSCNetSyncPointSignal& LastSignal = PendingServerSyncSignals.Last();
+		if (LastSignal.NumBatchedEvents > 0 && LastSignal.NumBatchedEvents < MAX_uint8 && LastSignal.AbilityHandle == AbilityHandle && LastSignal.AbilityOriginalPredictionKey == AbilityOriginalPredictionKey)
+		{
+			LastSignal.NumBatchedEvents++;
+			return false;
+		}
+	}
+
+	QueueSyncPointSignal(EAbilityGenericReplicatedEvent::GenericSignalFromClient, AbilityHandle, AbilityOriginalPredictionKey, CurrentPredictionKey);
+	PendingServerSyncSignals.Last().NumBatchedEvents = 1;
+	return true;
+}
+
+void UGSCAbilitySystemComponent::FlushSyncPointSignals(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(FlushSyncSignalsHandle);
+	FlushSyncSignalsHandle.Reset();
+
+	FlushPendingServerSyncSignals();
+
+	GSCAbilitySystemComponent_Impl::FSyncChannelStats& Stats = GSCAbilitySystemComponent_Impl::SyncChannelStats;
+	constexpr int32 MaxSignalsPerRPC = GSCAbilitySystemComponent_Impl::MaxSyncPointSignalsPerRPC;
+	for (int32 Offset = 0; Offset < PendingClientSyncSignals.Num(); Offset += MaxSignalsPerRPC)
+	{
+		const int32 Count = FMath::Min(MaxSignalsPerRPC, PendingClientSyncSignals.Num() - Offset);
+		ClientSetSyncPointSignals(TArray<FGSCNetSyncPointSignal>(PendingClientSyncSignals.GetData() + Offset, Count));
+		Stats.NumSignals += Count;
+		Stats.NumRPCs++;
+	}
+	PendingClientSyncSignals.Reset();
+}
+
+void UGSCAbilitySystemComponent::FlushPendingServerSyncSignals()
+{
+	GSCAbilitySystemComponent_Impl::FSyncChannelStats& Stats = GSCAbilitySystemComponent_Impl::SyncChannelStats;
+	constexpr int32 MaxSignalsPerRPC = GSCAbilitySystemComponent_Impl::MaxSyncPointSignalsPerRPC;
+	for (int32 Offset = 0; Offset < PendingServerSyncSignals.Num(); Offset += MaxSignalsPerRPC)
+	{
+		const int32 Count = FMath::Min(MaxSignalsPerRPC, PendingServerSyncSignals.Num() - Offset);
+		ServerSetSyncPointSignals(TArray<FGSCNetSyncPointSignal>(PendingServerSyncSignals.GetData() + Offset, Count));
+		Stats.NumSignals += Count;
+		Stats.NumRPCs++;
+	}
+	PendingServerSyncSignals.Reset();
+}
+
+void UGSCAbilitySystemComponent::CallServerTryActivateAbility(const FGameplayAbilitySpecHandle AbilityToActivate, const bool InputPressed, const FPredictionKey PredictionKey)
+{
+	FlushPendingServerSyncSignals();
+	Super::CallServerTryActivateAbility(AbilityToActivate, InputPressed, PredictionKey);
+}
+
+void UGSCAbilitySystemComponent::CallServerSetReplicatedTargetData(const FGameplayAbilitySpecHandle AbilityHandle, const FPredictionKey AbilityOriginalPredictionKey, const FGameplayAbilityTargetDataHandle& ReplicatedTargetDataHandle, const FGameplayTag ApplicationTag, const FPredictionKey CurrentPredictionKey)
+{
+	FlushPendingServerSyncSignals();
+	Super::CallServerSetReplicatedTargetData(AbilityHandle, AbilityOriginalPredictionKey, ReplicatedTargetDataHandle, ApplicationTag, CurrentPredictionKey);
+}
+
+void UGSCAbilitySystemComponent::CallServerEndAbility(const FGameplayAbilitySpecHandle AbilityToEnd, const FGameplayAbilityActivationInfo ActivationInfo, const FPredictionKey PredictionKey)
+{
+	FlushPendingServerSyncSignals();
+	Super::CallServerEndAbility(AbilityToEnd, ActivationInfo, PredictionKey);
+}
+
+void UGSCAbilitySystemComponent::ReceiveSyncPointSignals(const EAbilityGenericReplicatedEvent::Type EventType, const TArray<FGSCNetSyncPointSignal>& Signals)
+{
+	for (const FGSCNetSyncPointSignal& Signal : Signals)
+	{
+		if (Signal.NumBatchedEvents > 0 && EventType == EAbilityGenericReplicatedEvent::GenericSignalFromClient)
+		{
+			// Batch of coalesced gameplay events, the listening task releases that many of its pending events
+			FScopedPredictionWindow ScopedPrediction(this, Signal.CurrentPredictionKey);
+			OnSyncEventBatchReceived.Broadcast(Signal.AbilityHandle, Signal.AbilityOriginalPredictionKey, Signal.NumBatchedEvents);
+		}
+		else if (EventType == EAbilityGenericReplicatedEvent::GenericSignalFromClient)
+		{
+			// Same as ServerSetReplicatedEvent, run in the client prediction window
+			FScopedPredictionWindow ScopedPrediction(this, Signal.CurrentPredictionKey);
+			InvokeReplicatedEvent(EventType, Signal.AbilityHandle, Signal.AbilityOriginalPredictionKey, Signal.CurrentPredictionKey);
+		}
+		else
+		{
+			InvokeReplicatedEvent(EventType, Signal.AbilityHandle, Signal.AbilityOriginalPredictionKey);
+		}
+	}
+}
+
+bool UGSCAbilitySystemComponent::ServerSetSyncPointSignals_Validate(const TArray<FGSCNetSyncPointSignal>& Signals)
+{
+	return Signals.Num() <= GSCAbilitySystemComponent_Impl::MaxSyncPointSignalsPerRPC;
+}
+
+void UGSCAbilitySystemComponent::ServerSetSyncPointSignals_Implementation(const TArray<FGSCNetSyncPointSignal>& Signals)
+{
+	ReceiveSyncPointSignals(EAbilityGenericReplicatedEvent::GenericSignalFromClient, Signals);
+}
+
+void UGSCAbilitySystemComponent::ClientSetSyncPointSignals_Implementation(const TArray<FGSCNetSyncPointSignal>& Signals)
+{
+	ReceiveSyncPointSignals(EAbilityGenericReplicatedEvent::GenericSignalFromServer, Signals);
+}
+
+void UGSCAbilitySystemComponent::CaptureSnapshot(FGSCAbilitySystemSnapshot& OutSnapshot) const
+{
+	if (!IsOwnerActorAuthoritative())
+	{
+		return;
+	}
+
+	OutSnapshot.Abilities.Reserve(ActivatableAbilities.Items.Num());
+	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+	{
+		if (!AbilitySpec.Ability
+			|| AbilitySpec.PendingRemove
+			|| AbilitySpec.RemoveAfterActivation
+			|| GSCAbilitySystemComponent_Impl::IsGrantedByGameFeature(AbilitySpec.SourceObject))
+		{
+			continue;
+		}
+
+		FGSCAbilitySnapshot& AbilitySnapshot = OutSnapshot.Abilities.AddDefaulted_GetRef();
+		AbilitySnapshot.Ability = AbilitySpec.Ability->GetClass();
+		AbilitySnapshot.Level = AbilitySpec.Level;
+	}
+
+	for (const UAttributeSet* AttributeSet : GetSpawnedAttributes())
+	{
+		if (AttributeSet)
+		{
+			OutSnapshot.AttributeSets.Add(AttributeSet->GetClass());
+		}
+	}
+
+	TArray<FGameplayAttribute> Attributes;
+	GetAllAttributes(Attributes);
+	OutSnapshot.Attributes.Reserve(Attributes.Num());
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		FGSCAttributeSnapshot& AttributeSnapshot = OutSnapshot.Attributes.AddDefaulted_GetRef();
+		AttributeSnapshot.Attribute = Attribute;
+		AttributeSnapshot.BaseValue = GetNumericAttributeBase(Attribute);
+	}
+
+	for (const FActiveGameplayEffect& ActiveEffect : &ActiveGameplayEffects)
+	{
+		// Only effects this component applied to itself. Effects applied by other ASCs belong to them, effects applied by
+		// abilities are left to the (restored) abilities, startup effects are re-applied on BeginPlay and Game Feature ones
+		// by the Game Feature action
+		const FGameplayEffectContextHandle& EffectContext = ActiveEffect.Spec.GetContext();
+		if (ActiveEffect.IsPendingRemove
+			|| !ActiveEffect.Spec.Def
+			|| ActiveEffect.GetDuration() != FGameplayEffectConstants::INFINITE_DURATION
+			|| EffectContext.GetInstigatorAbilitySystemComponent() != this
+			|| EffectContext.GetAbility() != nullptr
+			|| GSCAbilitySystemComponent_Impl::IsGrantedByGameFeature(EffectContext.GetSourceObject())
+			|| AddedEffects.Contains(ActiveEffect.Handle))
+		{
+			continue;
+		}
+
+		FGSCEffectSnapshot& EffectSnapshot = OutSnapshot.Effects.AddDefaulted_GetRef();
+		EffectSnapshot.Effect = ActiveEffect.Spec.Def->GetClass();
+		EffectSnapshot.Level = ActiveEffect.Spec.GetLevel();
+		EffectSnapshot.StackCount = ActiveEffect.Spec.StackCount;
+		EffectSnapshot.Context = EffectContext;
+	}
+}
+
+void UGSCAbilitySystemComponent::RestoreSnapshot(const FGSCAbilitySystemSnapshot& Snapshot)
+{
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_RestoreSnapshot);
+	LLM_SCOPE_BYTAG(GASCompanion);
+
+	if (!IsOwnerActorAuthoritative() || Snapshot.IsEmpty())
+	{
+		return;
+	}
+
+	GSC_LOG(
+		Log,
+		TEXT("UGSCAbilitySystemComponent::RestoreSnapshot for %s - %d abilities, %d attribute sets (%d attributes), %d effects"),
+		*GetNameSafe(GetOwner()),
+		Snapshot.Abilities.Num(),
+		Snapshot.AttributeSets.Num(),
+		Snapshot.Attributes.Num(),
+		Snapshot.Effects.Num()
+	)
+
+	if (!bResetAbilitiesOnSpawn)
+	{
+		LLM_SCOPE_BYTAG(GASCompanion_Abilities);
+		for (const FGSCAbilitySnapshot& AbilitySnapshot : Snapshot.Abilities)
+		{
+			if (!AbilitySnapshot.Ability || FindAbilitySpecFromClass(AbilitySnapshot.Ability))
+			{
+				continue;
+			}
+
+			// No input ID, the previous one may collide with IDs handed out by UGSCInputIDSubsystem. Input binding component assigns it.
+			const FGameplayAbilitySpecHandle AbilityHandle = GiveAbility(FGameplayAbilitySpec(AbilitySnapshot.Ability, AbilitySnapshot.Level, INDEX_NONE));
+
+			// Keep track of startup abilities, as if granted by GrantDefaultAbilitiesAndAttributes
+			const FGSCAbilityInputMapping* GrantedAbility = GrantedAbilities.FindByPredicate([&AbilitySnapshot](const FGSCAbilityInputMapping& Mapping)
+			{
+				return Mapping.Ability == AbilitySnapshot.Ability;
+			});
+
+			if (GrantedAbility)
+			{
+				DefaultAbilityHandles.Add(FGSCMappedAbility(AbilityHandle, AbilitySnapshot.Ability, GrantedAbility->InputAction));
+			}
+		}
+	}
+
+	if (!bResetAttributesOnSpawn)
+	{
+		LLM_SCOPE_BYTAG(GASCompanion_Attributes);
+		for (const TSubclassOf<UAttributeSet> AttributeSetClass : Snapshot.AttributeSets)
+		{
+			if (!AttributeSetClass || GetAttributeSubobject(AttributeSetClass))
+			{
+				continue;
+			}
+
+			UAttributeSet* AttributeSet = NewObject<UAttributeSet>(GetOwner(), AttributeSetClass);
+			AddedAttributes.Add(AttributeSet);
+			AddAttributeSetSubobject(AttributeSet);
+		}
+
+		for (const FGSCAttributeSnapshot& AttributeSnapshot : Snapshot.Attributes)
+		{
+			if (HasAttributeSetForAttribute(AttributeSnapshot.Attribute))
+			{
+				SetNumericAttributeBase(AttributeSnapshot.Attribute, AttributeSnapshot.BaseValue);
+			}
+		}
+	}
+
+	// Effects may modify attributes, they would be stacked on top of reset values otherwise
+	if (!bResetAttributesOnSpawn)
+	{
+		for (const FGSCEffectSnapshot& EffectSnapshot : Snapshot.Effects)
+		{
+			if (!EffectSnapshot.Effect)
+			{
+				continue;
+			}
+
+			// Keep the original context (source object, hit result, ...), only the instigator is rebound to this component owner
+			FGameplayEffectContextHandle EffectContext = EffectSnapshot.Context.IsValid() ? EffectSnapshot.Context.Duplicate() : MakeEffectContext();
+			EffectContext.AddInstigator(GetOwner(), GetAvatarActor_Direct());
+
+			FGameplayEffectSpecHandle NewHandle = MakeOutgoingSpec(EffectSnapshot.Effect, EffectSnapshot.Level, EffectContext);
+			if (NewHandle.IsValid())
+			{
+				NewHandle.Data->SetStackCount(EffectSnapshot.StackCount);
+				ApplyGameplayEffectSpecToSelf(*NewHandle.Data.Get());
+			}
+		}
+	}
+}
+
+void UGSCAbilitySystemComponent::SetProfile(const EGSCAbilitySystemProfile NewProfile)
+{
+	Profile = NewProfile;
+
+	if (IsCrowdProfile())
+	{
+		SetReplicationMode(EGameplayEffectReplicationMode::Minimal);
+	}
+}
+
 void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOwnerActor, AActor* InAvatarActor)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_GrantDefaultAbilitiesAndAttributes);
+	LLM_SCOPE_BYTAG(GASCompanion_Abilities);
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes() - Owner: %s, Avatar: %s"), *InOwnerActor->GetName(), *InAvatarActor->GetName())
 
 	if (bResetAttributesOnSpawn)
@@ -344,7 +799,8 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 		InputBindingDelegateHandles.Empty();
 	}
 
-	UGSCAbilityInputBindingComponent* InputComponent = IsValid(InAvatarActor) ? InAvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
+	// No input binding for crowd profile, abilities are activated by AI
+	UGSCAbilityInputBindingComponent* InputComponent = !IsCrowdProfile() && IsValid(InAvatarActor) ? InAvatarActor->FindComponentByClass<UGSCAbilityInputBindingComponent>() : nullptr;
 
 	// Startup abilities
 	for (const FGSCAbilityInputMapping GrantedAbility : GrantedAbilities)
@@ -366,7 +822,7 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 			// Only Grant abilities on authority
 			GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes - Authority, Grant Ability (%s)"), *NewAbilitySpec.Ability->GetClass()->GetName())
 			FGameplayAbilitySpecHandle AbilityHandle = GiveAbility(NewAbilitySpec);
-			DefaultAbilityHandles.Add(FGSCMappedAbility(AbilityHandle, NewAbilitySpec, InputAction));
+			DefaultAbilityHandles.Add(FGSCMappedAbility(AbilityHandle, Ability, InputAction));
 		}
 
 		// We don't grant here but try to get the spec already granted or register delegate to handle input binding
@@ -381,13 +837,14 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 			else
 			{
 				// Register a delegate triggered when ability is granted and available on clients
-				FDelegateHandle DelegateHandle = OnGiveAbilityDelegate.AddUObject(this, &UGSCAbilitySystemComponent::HandleOnGiveAbility, InputComponent, InputAction, GrantedAbility.TriggerEvent, NewAbilitySpec);
+				FDelegateHandle DelegateHandle = OnGiveAbilityDelegate.AddUObject(this, &UGSCAbilitySystemComponent::HandleOnGiveAbility, InputComponent, InputAction, GrantedAbility.TriggerEvent, Ability);
 				InputBindingDelegateHandles.Add(DelegateHandle);
 			}
 		}
 	}
 
 	// Startup attributes
+	LLM_SCOPE_BYTAG(GASCompanion_Attributes);
 	for (const FGSCAttributeSetDefinition& AttributeSetDefinition : GrantedAttributes)
 	{
 		if (AttributeSetDefinition.AttributeSet)
@@ -417,8 +874,10 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 
 void UGSCAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
 {
+	LLM_SCOPE_BYTAG(GASCompanion_Abilities);
 	Super::OnGiveAbility(AbilitySpec);
 	GSC_LOG(Log, TEXT("UGSCAbilitySystemComponent::OnGiveAbility %s"), *AbilitySpec.Ability->GetName());
+	GSC_TRACE_EVENT(AbilityGranted, GetAvatarActor(), AbilitySpec.Ability, AbilitySpec.ActivationInfo.GetActivationPredictionKey(), AbilitySpec.Level)
 	OnGiveAbilityDelegate.Broadcast(AbilitySpec);
 }
 
@@ -451,6 +910,15 @@ void UGSCAbilitySystemComponent::GrantStartupEffects()
 	}
 }
 
+void UGSCAbilitySystemComponent::UnregisterFromPawnControllerSubsystem() const
+{
+	const APawn* OwnerPawn = AbilityActorInfo ? Cast<APawn>(AbilityActorInfo->OwnerActor.Get()) : nullptr;
+	if (UGSCPawnControllerSubsystem* PawnControllerSubsystem = UGSCPawnControllerSubsystem::Get(OwnerPawn))
+	{
+		PawnControllerSubsystem->UnregisterAbilitySystem(OwnerPawn, this);
+	}
+}
+
 // ReSharper disable CppParameterMayBeConstPtrOrRef
 void UGSCAbilitySystemComponent::OnPawnControllerChanged(APawn* Pawn, AController* NewController)
 {
@@ -467,7 +935,7 @@ void UGSCAbilitySystemComponent::OnPawnControllerChanged(APawn* Pawn, AControlle
 	}
 }
 
-void UGSCAbilitySystemComponent::HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, FGameplayAbilitySpec NewAbilitySpec)
+void UGSCAbilitySystemComponent::HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, TSubclassOf<UGameplayAbility> AbilityClass)
 {
 	GSC_LOG(
 		Log,
@@ -479,7 +947,7 @@ void UGSCAbilitySystemComponent::HandleOnGiveAbility(FGameplayAbilitySpec& Abili
 		*GetNameSafe(InputComponent)
 	);
 
-	if (InputComponent && InputAction && AbilitySpec.Ability == NewAbilitySpec.Ability)
+	if (InputComponent && InputAction && AbilitySpec.Ability && AbilitySpec.Ability->GetClass() == AbilityClass)
 	{
 		InputComponent->SetInputBinding(InputAction, TriggerEvent, AbilitySpec.Handle);
 	}
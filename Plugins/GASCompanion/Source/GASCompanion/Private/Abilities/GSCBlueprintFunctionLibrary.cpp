@@ -183,3 +183,29 @@ void UGSCBlueprintFunctionLibrary::RemoveAllGameplayCues(AActor* Actor)
 		AbilitySystemComponent->RemoveAllGameplayCues();
 	}
 }
+
+bool UGSCBlueprintFunctionLibrary::GetActiveGameplayEffectUIData(const FActiveGameplayEffectHandle ActiveHandle, FGSCGameplayEffectUIData& OutEffectData)
+{
+	const UAbilitySystemComponent* ASC = ActiveHandle.GetOwningAbilitySystemComponent();
+	const FActiveGameplayEffect* ActiveGameplayEffect = ASC ? ASC->GetActiveGameplayEffect(ActiveHandle) : nullptr;
+	if (!ActiveGameplayEffect)
+	{
+		OutEffectData = FGSCGameplayEffectUIData();
+		return false;
+	}
+
+	OutEffectData = MakeGameplayEffectUIData(*ActiveGameplayEffect);
+	return true;
+}
+
+FGSCGameplayEffectUIData UGSCBlueprintFunctionLibrary::MakeGameplayEffectUIData(const FActiveGameplayEffect& ActiveGameplayEffect)
+{
+	const UGameplayEffect* Definition = ActiveGameplayEffect.Spec.Def;
+	return FGSCGameplayEffectUIData(
+		ActiveGameplayEffect.StartWorldTime,
+		ActiveGameplayEffect.GetDuration(),
+		ActiveGameplayEffect.GetEndTime(),
+		ActiveGameplayEffect.Spec.StackCount,
+		Definition ? Definition->StackLimitCount : -1
+	);
+}
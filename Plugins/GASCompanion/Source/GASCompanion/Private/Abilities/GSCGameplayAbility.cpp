@@ -5,10 +5,13 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCTargetDataTypes.h"
 #include "Abilities/GSCTargetType.h"
 #include "Components/GSCAbilityQueueComponent.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
 
 UGSCGameplayAbility::UGSCGameplayAbility() {}
 
@@ -22,15 +25,7 @@ FGSCGameplayEffectContainerSpec UGSCGameplayAbility::MakeEffectContainerSpecFrom
 	if (OwningASC)
 	{
 		// If we have a target type, run the targeting logic. This is optional, targets can be added later
-		if (Container.TargetType.Get())
-		{
-			TArray<FHitResult> HitResults;
-			TArray<AActor*> TargetActors;
-			const UGSCTargetType* TargetTypeCDO = Container.TargetType.GetDefaultObject();
-			AActor* AvatarActor = GetAvatarActorFromActorInfo();
-			TargetTypeCDO->GetTargets(AvatarActor, EventData, HitResults, TargetActors);
-			ReturnSpec.AddTargets(HitResults, TargetActors);
-		}
+		AddEffectContainerTargets(Container, EventData, ReturnSpec);
 
 		// If we don't have an override level, use the default on the ability itself
 		if (OverrideGameplayLevel == INDEX_NONE)
@@ -56,27 +51,141 @@ FGSCGameplayEffectContainerSpec UGSCGameplayAbility::MakeEffectContainerSpecFrom
 
 FGSCGameplayEffectContainerSpec UGSCGameplayAbility::MakeEffectContainerSpec(FGameplayTag ContainerTag, const FGameplayEventData& EventData, int32 OverrideGameplayLevel)
 {
+	LLM_SCOPE_BYTAG(GASCompanion_Abilities);
 	FGSCGameplayEffectContainer* FoundContainer = EffectContainerMap.Find(ContainerTag);
+	if (!FoundContainer)
+	{
+		return FGSCGameplayEffectContainerSpec();
+	}
 
-	if (FoundContainer)
+	if (!CanUseEffectContainerSpecCache())
 	{
 		return MakeEffectContainerSpecFromContainer(*FoundContainer, EventData, OverrideGameplayLevel);
 	}
-	return FGSCGameplayEffectContainerSpec();
+
+	FGSCGameplayEffectContainerSpec ReturnSpec;
+	AddEffectContainerTargets(*FoundContainer, EventData, ReturnSpec);
+
+	// If we don't have an override level, use the default on the ability itself
+	const int32 Level = OverrideGameplayLevel == INDEX_NONE ? GetAbilityLevel() : OverrideGameplayLevel;
+	const FGameplayAbilitySpec* AbilitySpec = GetCurrentAbilitySpec();
+	const FGSCEffectContainerSpecTemplate& Template = FindOrAddEffectContainerSpecTemplate(ContainerTag, *FoundContainer, Level, AbilitySpec);
+
+	// Clone specs from the template, only patching up the context and SetByCaller values
+	ReturnSpec.TargetGameplayEffectSpecs.Reserve(Template.Specs.Num());
+
+	for (const FGameplayEffectSpec& SpecTemplate : Template.Specs)
+	{
+		FGameplayEffectSpec* Spec = new FGameplayEffectSpec(SpecTemplate);
+
+		// SetContext recaptures source attributes and tags, so that snapshot values are the current ones
+		Spec->SetContext(MakeEffectContext(CurrentSpecHandle, CurrentActorInfo));
+
+		if (AbilitySpec)
+		{
+			Spec->SetByCallerTagMagnitudes = AbilitySpec->SetByCallerTagMagnitudes;
+		}
+
+		if (FoundContainer->bUseSetByCallerMagnitude)
+		{
+			Spec->SetSetByCallerMagnitude(FoundContainer->SetByCallerDataTag, FoundContainer->SetByCallerMagnitude);
+		}
+
+		ReturnSpec.TargetGameplayEffectSpecs.Add(FGameplayEffectSpecHandle(Spec));
+	}
+
+	return ReturnSpec;
 }
 
-TArray<FActiveGameplayEffectHandle> UGSCGameplayAbility::ApplyEffectContainerSpec(const FGSCGameplayEffectContainerSpec& ContainerSpec)
+void UGSCGameplayAbility::InvalidateEffectContainerSpecCache()
 {
-	TArray<FActiveGameplayEffectHandle> AllEffects;
+	EffectContainerSpecTemplates.Reset();
+}
 
-	// Iterate list of effect specs and apply them to their target data
-	for (const FGameplayEffectSpecHandle& SpecHandle : ContainerSpec.TargetGameplayEffectSpecs)
+bool UGSCGameplayAbility::CanUseEffectContainerSpecCache() const
+{
+	// Non instanced abilities run on the CDO, which is shared between all actors
+	return bCacheEffectContainerSpecs && IsInstantiated() && CurrentActorInfo && CurrentActorInfo->AbilitySystemComponent.IsValid();
+}
+
+const FGSCEffectContainerSpecTemplate& UGSCGameplayAbility::FindOrAddEffectContainerSpecTemplate(const FGameplayTag ContainerTag, const FGSCGameplayEffectContainer& Container, const int32 Level, const FGameplayAbilitySpec* AbilitySpec)
+{
+	static const FGameplayTagContainer EmptyTags;
+	static const TMap<FGameplayTag, float> EmptySetByCallerTagMagnitudes;
+	const FGameplayTagContainer& DynamicAbilityTags = AbilitySpec ? AbilitySpec->DynamicAbilityTags : EmptyTags;
+	const TMap<FGameplayTag, float>& SetByCallerTagMagnitudes = AbilitySpec ? AbilitySpec->SetByCallerTagMagnitudes : EmptySetByCallerTagMagnitudes;
+
+	FGSCEffectContainerSpecTemplate* Template = EffectContainerSpecTemplates.FindByPredicate([ContainerTag, Level](const FGSCEffectContainerSpecTemplate& Entry)
+	{
+		return Entry.ContainerTag == ContainerTag && Entry.Level == Level;
+	});
+
+	if (Template)
+	{
+		// Dynamic tags and SetByCaller values are baked in the specs, rebuild them if they changed since
+		if (Template->DynamicAbilityTags == DynamicAbilityTags && Template->SetByCallerTagMagnitudes.OrderIndependentCompareEqual(SetByCallerTagMagnitudes))
+		{
+			return *Template;
+		}
+
+		Template->Specs.Reset();
+	}
+	else
+	{
+		Template = &EffectContainerSpecTemplates.AddDefaulted_GetRef();
+		Template->ContainerTag = ContainerTag;
+		Template->Level = Level;
+	}
+
+	GSC_LOG(Verbose, TEXT("UGSCGameplayAbility::FindOrAddEffectContainerSpecTemplate %s - Build templates for %s (Level: %d)"), *GetName(), *ContainerTag.ToString(), Level)
+
+	Template->DynamicAbilityTags = DynamicAbilityTags;
+	Template->SetByCallerTagMagnitudes = SetByCallerTagMagnitudes;
+	Template->Specs.Reserve(Container.TargetGameplayEffectClasses.Num());
+
+	for (const TSubclassOf<UGameplayEffect>& EffectClass : Container.TargetGameplayEffectClasses)
+	{
+		const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(EffectClass, Level);
+		if (SpecHandle.IsValid())
+		{
+			Template->Specs.Add(*SpecHandle.Data.Get());
+		}
+	}
+
+	return *Template;
+}
+
+void UGSCGameplayAbility::AddEffectContainerTargets(const FGSCGameplayEffectContainer& Container, const FGameplayEventData& EventData, FGSCGameplayEffectContainerSpec& OutSpec)
+{
+	if (!Container.TargetType.Get())
 	{
-		AllEffects.Append(K2_ApplyGameplayEffectSpecToTarget(SpecHandle, ContainerSpec.TargetData));
+		return;
 	}
+
+	const UGSCTargetType* TargetTypeCDO = Container.TargetType.GetDefaultObject();
+
+	// Inline allocated, the common case of a few targets doesn't hit the heap
+	FGSCTargetHitResults HitResults;
+	FGSCTargetActors TargetActors;
+	TargetTypeCDO->GatherTargets(GetAvatarActorFromActorInfo(), EventData, HitResults, TargetActors);
+	OutSpec.AddTargets(HitResults, TargetActors, Container.bUseMultiHitTargetData);
+}
+
+TArray<FActiveGameplayEffectHandle> UGSCGameplayAbility::ApplyEffectContainerSpec(const FGSCGameplayEffectContainerSpec& ContainerSpec)
+{
+	TArray<FActiveGameplayEffectHandle> AllEffects;
+	FGSCGameplayEffectContainerResult Result;
+	ApplyEffectContainerSpecInternal(ContainerSpec, Result, &AllEffects);
 	return AllEffects;
 }
 
+FGSCGameplayEffectContainerResult UGSCGameplayAbility::ApplyEffectContainerSpecBatched(const FGSCGameplayEffectContainerSpec& ContainerSpec)
+{
+	FGSCGameplayEffectContainerResult Result;
+	ApplyEffectContainerSpecInternal(ContainerSpec, Result, nullptr);
+	return Result;
+}
+
 TArray<FActiveGameplayEffectHandle> UGSCGameplayAbility::ApplyEffectContainer(FGameplayTag ContainerTag, const FGameplayEventData& EventData, int32 OverrideGameplayLevel)
 {
 	const FGSCGameplayEffectContainerSpec Spec = MakeEffectContainerSpec(ContainerTag, EventData, OverrideGameplayLevel);
@@ -87,6 +196,15 @@ void UGSCGameplayAbility::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo
 {
 	Super::OnAvatarSet(ActorInfo, Spec);
 
+	// Cached effect specs reference the previous avatar
+	InvalidateEffectContainerSpecCache();
+
+	// Resolve queue component for the new avatar now, rather than on first activation
+	if (bEnableAbilityQueue && IsInstantiated())
+	{
+		GetAbilityQueueComponent();
+	}
+
 	if (bActivateOnGranted)
 	{
 		ActorInfo->AbilitySystemComponent->TryActivateAbility(Spec.Handle, false);
@@ -122,21 +240,20 @@ bool UGSCGameplayAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Ha
 void UGSCGameplayAbility::PreActivate(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, FOnGameplayAbilityEnded::FDelegate* OnGameplayAbilityEndedDelegate, const FGameplayEventData* TriggerEventData)
 {
 	Super::PreActivate(Handle, ActorInfo, ActivationInfo, OnGameplayAbilityEndedDelegate);
-	OnGameplayAbilityEnded.AddUObject(this, &UGSCGameplayAbility::AbilityEnded);
 
-	// Open ability queue only if told to do so
-	if (!bEnableAbilityQueue)
+	// GSC ASC calls AbilityEnded from NotifyAbilityEnded, only bind (every activation, as EndAbility clears the delegate) for other ASC types
+	if (!Cast<UGSCAbilitySystemComponent>(ActorInfo->AbilitySystemComponent.Get()))
 	{
-		return;
+		OnGameplayAbilityEnded.AddUObject(this, &UGSCGameplayAbility::AbilityEnded);
 	}
 
-	AActor* Avatar = GetAvatarActorFromActorInfo();
-	if (!Avatar)
+	// Open ability queue only if told to do so
+	if (!bEnableAbilityQueue)
 	{
 		return;
 	}
 
-	UGSCAbilityQueueComponent* AbilityQueueComponent = UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Avatar);
+	UGSCAbilityQueueComponent* AbilityQueueComponent = GetAbilityQueueComponent();
 	if (!AbilityQueueComponent)
 	{
 		return;
@@ -147,6 +264,23 @@ void UGSCGameplayAbility::PreActivate(const FGameplayAbilitySpecHandle Handle, c
 	AbilityQueueComponent->SetAllowAllAbilitiesForAbilityQueue(true);
 }
 
+UGSCAbilityQueueComponent* UGSCGameplayAbility::GetAbilityQueueComponent()
+{
+	const AActor* Avatar = GetAvatarActorFromActorInfo();
+	if (!Avatar)
+	{
+		return nullptr;
+	}
+
+	if (CachedAbilityQueueAvatar.Get() != Avatar)
+	{
+		CachedAbilityQueueAvatar = Avatar;
+		CachedAbilityQueueComponent = UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Avatar);
+	}
+
+	return CachedAbilityQueueComponent.Get();
+}
+
 void UGSCGameplayAbility::AbilityEnded(UGameplayAbility* Ability)
 {
 	GSC_LOG(Log, TEXT("UGSCGameplayAbility::AbilityEnded"))
@@ -163,6 +297,127 @@ void UGSCGameplayAbility::AbilityEnded(UGameplayAbility* Ability)
 	OnAbilityEnded.Clear();
 }
 
+void UGSCGameplayAbility::ApplyEffectContainerSpecInternal(const FGSCGameplayEffectContainerSpec& ContainerSpec, FGSCGameplayEffectContainerResult& OutResult, TArray<FActiveGameplayEffectHandle>* OutAllHandles)
+{
+	const FGameplayAbilityActorInfo* ActorInfo = GetCurrentActorInfo();
+	if (!ActorInfo || !ContainerSpec.HasValidEffects() || !HasAuthorityOrPredictionKey(ActorInfo, &CurrentActivationInfo))
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* SourceASC = ActorInfo->AbilitySystemComponent.Get();
+	if (!SourceASC)
+	{
+		return;
+	}
+
+	// A single target, along with the target data (and hit result for multi hit target data) it comes from
+	struct FResolvedTarget
+	{
+		UAbilitySystemComponent* AbilitySystemComponent;
+		const FGameplayAbilityTargetData* TargetData;
+		const FHitResult* HitResult;
+	};
+
+	// Resolve targets once for all effect specs in the container
+	TArray<FResolvedTarget, TInlineAllocator<16>> Targets;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& TargetData : ContainerSpec.TargetData.Data)
+	{
+		if (!TargetData.IsValid())
+		{
+			GSC_LOG(Warning, TEXT("UGSCGameplayAbility::ApplyEffectContainerSpec invalid target data passed in. Ability: %s"), *GetPathName())
+			continue;
+		}
+
+		if (TargetData->GetScriptStruct() == FGSCGameplayAbilityTargetData_MultiHit::StaticStruct())
+		{
+			// Keep track of the hit result for each target, so that each effect context gets its own
+			for (const FHitResult& HitResult : static_cast<const FGSCGameplayAbilityTargetData_MultiHit*>(TargetData.Get())->HitResults)
+			{
+				if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitResult.GetActor()))
+				{
+					Targets.Add({ TargetASC, TargetData.Get(), &HitResult });
+				}
+			}
+			continue;
+		}
+
+		for (const TWeakObjectPtr<AActor>& TargetActor : TargetData->GetActors())
+		{
+			if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor.Get()))
+			{
+				Targets.Add({ TargetASC, TargetData.Get(), nullptr });
+			}
+		}
+	}
+
+	OutResult.NumTargets += Targets.Num();
+	if (Targets.Num() == 0)
+	{
+		return;
+	}
+
+	if (OutAllHandles)
+	{
+		OutAllHandles->Reserve(OutAllHandles->Num() + Targets.Num() * ContainerSpec.TargetGameplayEffectSpecs.Num());
+	}
+
+	const FPredictionKey PredictionKey = CurrentActivationInfo.GetActivationPredictionKey();
+	TARGETLIST_SCOPE_LOCK(*SourceASC);
+
+	for (const FGameplayEffectSpecHandle& SpecHandle : ContainerSpec.TargetGameplayEffectSpecs)
+	{
+		if (!SpecHandle.IsValid())
+		{
+			continue;
+		}
+
+		// Single copy of the spec per container spec, only the context is swapped for each target. The target ASC makes its own copy on application.
+		FGameplayEffectSpec WorkingSpec(*SpecHandle.Data.Get());
+		const FGameplayEffectContextHandle BaseContext = WorkingSpec.GetContext();
+		UAbilitySystemComponent* InstigatorASC = BaseContext.IsValid() ? BaseContext.GetInstigatorAbilitySystemComponent() : nullptr;
+		if (!ensure(InstigatorASC))
+		{
+			continue;
+		}
+
+		for (const FResolvedTarget& Target : Targets)
+		{
+			// Each target needs its own context, otherwise targeting info gets accumulated
+			FGameplayEffectContextHandle EffectContext = BaseContext.Duplicate();
+			if (Target.HitResult)
+			{
+				EffectContext.AddHitResult(*Target.HitResult, true);
+				EffectContext.AddOrigin(Target.HitResult->TraceStart);
+			}
+			else
+			{
+				Target.TargetData->AddTargetDataToContext(EffectContext, false);
+			}
+			WorkingSpec.SetContext(EffectContext);
+
+			const FActiveGameplayEffectHandle EffectHandle = InstigatorASC->ApplyGameplayEffectSpecToTarget(WorkingSpec, Target.AbilitySystemComponent, PredictionKey);
+			if (EffectHandle.WasSuccessfullyApplied())
+			{
+				OutResult.NumApplied++;
+				if (EffectHandle.IsValid())
+				{
+					OutResult.ActiveHandles.Add(EffectHandle);
+				}
+			}
+			else
+			{
+				OutResult.NumBlocked++;
+			}
+
+			if (OutAllHandles)
+			{
+				OutAllHandles->Add(EffectHandle);
+			}
+		}
+	}
+}
+
 bool UGSCGameplayAbility::CheckForPositiveCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, FGameplayTagContainer* OptionalRelevantTags) const
 {
 	UGameplayEffect* CostGE = GetCostGameplayEffect();
@@ -171,7 +426,7 @@ bool UGSCGameplayAbility::CheckForPositiveCost(const FGameplayAbilitySpecHandle
 		return true;
 	}
 
-	if (!CanApplyPositiveAttributeModifiers(CostGE, ActorInfo, GetAbilityLevel(Handle, ActorInfo), MakeEffectContext(Handle, ActorInfo)))
+	if (!CanApplyPositiveAttributeModifiers(CostGE, ActorInfo))
 	{
 		const FGameplayTag& CostTag = UAbilitySystemGlobals::Get().ActivateFailCostTag;
 		if (OptionalRelevantTags && CostTag.IsValid())
@@ -185,46 +440,87 @@ bool UGSCGameplayAbility::CheckForPositiveCost(const FGameplayAbilitySpecHandle
 	return true;
 }
 
-bool UGSCGameplayAbility::CanApplyPositiveAttributeModifiers(const UGameplayEffect* GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo, const float Level, const FGameplayEffectContextHandle& EffectContext) const
+bool UGSCGameplayAbility::CanApplyPositiveAttributeModifiers(const UGameplayEffect* GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo) const
 {
-	FGameplayEffectSpec	Spec(GameplayEffect, EffectContext, Level);
-
-	Spec.CalculateModifierMagnitudes();
-
 	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.IsValid() ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
 	if (!ASC)
 	{
 		return false;
 	}
 
-	for(int32 ModIdx = 0; ModIdx < Spec.Modifiers.Num(); ++ModIdx)
+	// Non instanced abilities run on the CDO, which is shared between all actors, use a transient cache for them
+	FCostAttributesCache TransientCache;
+	FCostAttributesCache& Cache = IsInstantiated() ? CostAttributesCache : TransientCache;
+	UpdateCostAttributesCache(Cache, GameplayEffect, ASC);
+
+	for (int32 Index = 0; Index < Cache.Attributes.Num(); ++Index)
 	{
-		const FGameplayModifierInfo& ModDef = Spec.Def->Modifiers[ModIdx];
+		// Attribute Set is not on this ASC, nothing to check against
+		const UAttributeSet* Set = Cache.AttributeSets[Index].Get();
+		if (!Set)
+		{
+			continue;
+		}
+
+		const float CurrentValue = Cache.Attributes[Index].GetNumericValueChecked(Set);
+		if (CurrentValue <= 0.f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UGSCGameplayAbility::UpdateCostAttributesCache(FCostAttributesCache& Cache, const UGameplayEffect* GameplayEffect, UAbilitySystemComponent* AbilitySystemComponent)
+{
+	check(GameplayEffect && AbilitySystemComponent);
+
+	bool bNeedsResolve = false;
+
+	if (Cache.CostGameplayEffect.Get() != GameplayEffect)
+	{
+		Cache.CostGameplayEffect = GameplayEffect;
+		Cache.Attributes.Reset();
 
 		// It only makes sense to check additive operators
-		if (ModDef.ModifierOp == EGameplayModOp::Additive)
+		for (const FGameplayModifierInfo& ModDef : GameplayEffect->Modifiers)
 		{
-			if (!ModDef.Attribute.IsValid())
+			if (ModDef.ModifierOp == EGameplayModOp::Additive && ModDef.Attribute.IsValid())
 			{
-				continue;
+				Cache.Attributes.Add(ModDef.Attribute);
 			}
+		}
 
-			if (!ASC->HasAttributeSetForAttribute(ModDef.Attribute))
-			{
-				continue;
-			}
+		bNeedsResolve = true;
+	}
 
-			const UAttributeSet* Set = GetAttributeSubobjectForASC(ASC, ModDef.Attribute.GetAttributeSetClass());
-			const float CurrentValue = ModDef.Attribute.GetNumericValueChecked(Set);
+	const int32 NumSpawnedAttributes = AbilitySystemComponent->GetSpawnedAttributes().Num();
+	if (bNeedsResolve || Cache.AbilitySystemComponent.Get() != AbilitySystemComponent || Cache.NumSpawnedAttributes != NumSpawnedAttributes)
+	{
+		Cache.AbilitySystemComponent = AbilitySystemComponent;
+		Cache.NumSpawnedAttributes = NumSpawnedAttributes;
+		Cache.AttributeSets.Reset(Cache.Attributes.Num());
 
-			if (CurrentValue <= 0.f)
-			{
-				return false;
-			}
+		for (const FGameplayAttribute& Attribute : Cache.Attributes)
+		{
+			const UAttributeSet* Set = AbilitySystemComponent->HasAttributeSetForAttribute(Attribute) ?
+				GetAttributeSubobjectForASC(AbilitySystemComponent, Attribute.GetAttributeSetClass()) :
+				nullptr;
+
+			Cache.AttributeSets.Add(Set);
 		}
+		return;
 	}
 
-	return true;
+	// Attribute sets could have been removed and replaced with another one in between
+	for (int32 Index = 0; Index < Cache.AttributeSets.Num(); ++Index)
+	{
+		if (Cache.AttributeSets[Index].IsStale())
+		{
+			Cache.AttributeSets[Index] = GetAttributeSubobjectForASC(AbilitySystemComponent, Cache.Attributes[Index].GetAttributeSetClass());
+		}
+	}
 }
 
 const UAttributeSet* UGSCGameplayAbility::GetAttributeSubobjectForASC(UAbilitySystemComponent* AbilitySystemComponent, const TSubclassOf<UAttributeSet> AttributeClass)
@@ -0,0 +1,194 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCTargetDataTypes.h"
+
+namespace GSCTargetDataTypes_Impl
+{
+	/** Max number of instances kept around by each pool */
+	constexpr int32 MaxPooledTargetData = 256;
+
+	/** Max number of instances checked for reuse on each acquire, a new instance is allocated past that */
+	constexpr int32 MaxScannedTargetData = 16;
+}
+
+TArray<TWeakObjectPtr<AActor>> FGSCGameplayAbilityTargetData_MultiHit::GetActors() const
+{
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	Actors.Reserve(HitResults.Num());
+	for (const FHitResult& HitResult : HitResults)
+	{
+		if (AActor* Actor = HitResult.GetActor())
+		{
+			Actors.Add(Actor);
+		}
+	}
+	return Actors;
+}
+
+bool FGSCGameplayAbilityTargetData_MultiHit::SetActors(TArray<TWeakObjectPtr<AActor>> NewActorArray)
+{
+	// Hit results can't be changed through here (same as SingleTargetHit)
+	return false;
+}
+
+bool FGSCGameplayAbilityTargetData_MultiHit::HasHitResult() const
+{
+	return HitResults.Num() > 0;
+}
+
+const FHitResult* FGSCGameplayAbilityTargetData_MultiHit::GetHitResult() const
+{
+	return HitResults.Num() > 0 ? &HitResults[0] : nullptr;
+}
+
+bool FGSCGameplayAbilityTargetData_MultiHit::HasOrigin() const
+{
+	return HitResults.Num() > 0;
+}
+
+FTransform FGSCGameplayAbilityTargetData_MultiHit::GetOrigin() const
+{
+	if (HitResults.Num() == 0)
+	{
+		return FTransform::Identity;
+	}
+
+	const FHitResult& HitResult = HitResults[0];
+	return FTransform((HitResult.TraceEnd - HitResult.TraceStart).Rotation(), HitResult.TraceStart);
+}
+
+bool FGSCGameplayAbilityTargetData_MultiHit::HasEndPoint() const
+{
+	return HitResults.Num() > 0;
+}
+
+FVector FGSCGameplayAbilityTargetData_MultiHit::GetEndPoint() const
+{
+	return HitResults.Num() > 0 ? HitResults[0].Location : FVector::ZeroVector;
+}
+
+UScriptStruct* FGSCGameplayAbilityTargetData_MultiHit::GetScriptStruct() const
+{
+	return StaticStruct();
+}
+
+FString FGSCGameplayAbilityTargetData_MultiHit::ToString() const
+{
+	return FString::Printf(TEXT("FGSCGameplayAbilityTargetData_MultiHit (%d hits)"), HitResults.Num());
+}
+
+bool FGSCGameplayAbilityTargetData_MultiHit::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 NumHitResults = static_cast<uint8>(FMath::Min(HitResults.Num(), MaxNetSerializedHitResults));
+	Ar << NumHitResults;
+
+	if (Ar.IsLoading())
+	{
+		HitResults.SetNum(NumHitResults);
+	}
+
+	bOutSuccess = true;
+	for (int32 Index = 0; Index < NumHitResults; Index++)
+	{
+		bool bHitSuccess = true;
+		HitResults[Index].NetSerialize(Ar, Map, bHitSuccess);
+		bOutSuccess &= bHitSuccess;
+	}
+
+	return true;
+}
+
+template<typename TargetDataType>
+TSharedPtr<TargetDataType> FGSCTargetDataPool::TPool<TargetDataType>::Acquire()
+{
+	using namespace GSCTargetDataTypes_Impl;
+
+	// Look for an instance we're the only one referencing, starting where we left off last time. The scan is capped so that
+	// a pool full of in use instances doesn't cost a full pass on each acquire, next acquire picks up from there.
+	const int32 NumEntries = Entries.Num();
+	const int32 NumScanned = FMath::Min(NumEntries, MaxScannedTargetData);
+	for (int32 Offset = 0; Offset < NumScanned; Offset++)
+	{
+		const int32 Index = (Cursor + Offset) % NumEntries;
+		if (Entries[Index].IsUnique())
+		{
+			Cursor = (Index + 1) % NumEntries;
+			return Entries[Index];
+		}
+	}
+
+	if (NumEntries > 0)
+	{
+		Cursor = (Cursor + NumScanned) % NumEntries;
+	}
+
+	TSharedPtr<TargetDataType> NewEntry = MakeShared<TargetDataType>();
+	if (NumEntries < MaxPooledTargetData)
+	{
+		Entries.Add(NewEntry);
+	}
+
+	return NewEntry;
+}
+
+template<typename TargetDataType>
+void FGSCTargetDataPool::TPool<TargetDataType>::Trim()
+{
+	Entries.RemoveAllSwap([](const TSharedPtr<TargetDataType>& Entry)
+	{
+		return Entry.IsUnique();
+	});
+
+	Cursor = 0;
+}
+
+FGSCTargetDataPool& FGSCTargetDataPool::Get()
+{
+	static FGSCTargetDataPool Instance;
+	return Instance;
+}
+
+TSharedPtr<FGameplayAbilityTargetData_SingleTargetHit> FGSCTargetDataPool::AcquireSingleTargetHit(const FHitResult& HitResult)
+{
+	if (!IsInGameThread())
+	{
+		return MakeShared<FGameplayAbilityTargetData_SingleTargetHit>(HitResult);
+	}
+
+	TSharedPtr<FGameplayAbilityTargetData_SingleTargetHit> TargetData = SingleTargetHitPool.Acquire();
+	TargetData->HitResult = HitResult;
+	TargetData->bHitReplaced = false;
+	return TargetData;
+}
+
+TSharedPtr<FGameplayAbilityTargetData_ActorArray> FGSCTargetDataPool::AcquireActorArray(const TArrayView<AActor* const> TargetActors)
+{
+	TSharedPtr<FGameplayAbilityTargetData_ActorArray> TargetData = IsInGameThread() ?
+		ActorArrayPool.Acquire() :
+		MakeShared<FGameplayAbilityTargetData_ActorArray>();
+
+	TargetData->SourceLocation = FGameplayAbilityTargetingLocationInfo();
+	TargetData->TargetActorArray.Reset();
+	TargetData->TargetActorArray.Append(TargetActors.GetData(), TargetActors.Num());
+	return TargetData;
+}
+
+TSharedPtr<FGSCGameplayAbilityTargetData_MultiHit> FGSCTargetDataPool::AcquireMultiHit(const TArrayView<const FHitResult> HitResults)
+{
+	TSharedPtr<FGSCGameplayAbilityTargetData_MultiHit> TargetData = IsInGameThread() ?
+		MultiHitPool.Acquire() :
+		MakeShared<FGSCGameplayAbilityTargetData_MultiHit>();
+
+	// Reset + Append to keep the previously allocated capacity
+	TargetData->HitResults.Reset();
+	TargetData->HitResults.Append(HitResults.GetData(), HitResults.Num());
+	return TargetData;
+}
+
+void FGSCTargetDataPool::Trim()
+{
+	check(IsInGameThread());
+	SingleTargetHitPool.Trim();
+	ActorArrayPool.Trim();
+	MultiHitPool.Trim();
+}
@@ -7,3 +7,38 @@
 void UGSCTargetType::GetTargets_Implementation(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const
 {
 }
+
+void UGSCTargetType::GetTargetsNative(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const
+{
+	// Compatibility path for Blueprint target types
+	TArray<FHitResult> HitResults;
+	TArray<AActor*> Actors;
+	GetTargets(TargetingActor, EventData, HitResults, Actors);
+
+	OutHitResults.Append(HitResults);
+	OutActors.Append(Actors);
+}
+
+void UGSCTargetType::GatherTargets(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const
+{
+	if (HasBlueprintGetTargets())
+	{
+		UGSCTargetType::GetTargetsNative(TargetingActor, EventData, OutHitResults, OutActors);
+		return;
+	}
+
+	GetTargetsNative(TargetingActor, EventData, OutHitResults, OutActors);
+}
+
+bool UGSCTargetType::HasBlueprintGetTargets() const
+{
+	const UClass* Class = GetClass();
+	if (Class->IsNative())
+	{
+		return false;
+	}
+
+	// A Blueprint override of a BlueprintNativeEvent is a function owned by the Blueprint generated class
+	const UFunction* Function = Class->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UGSCTargetType, GetTargets));
+	return Function && !Function->GetOwnerClass()->IsNative();
+}
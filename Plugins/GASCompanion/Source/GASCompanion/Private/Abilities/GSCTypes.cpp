@@ -3,6 +3,8 @@
 
 #include "Abilities/GSCTypes.h"
 
+#include "Abilities/GSCTargetDataTypes.h"
+
 bool FGSCGameplayEffectContainerSpec::HasValidEffects() const
 {
 	return TargetGameplayEffectSpecs.Num() > 0;
@@ -13,18 +15,27 @@ bool FGSCGameplayEffectContainerSpec::HasValidTargets() const
 	return TargetData.Num() > 0;
 }
 
-void FGSCGameplayEffectContainerSpec::AddTargets(const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors)
+void FGSCGameplayEffectContainerSpec::AddTargets(const TArrayView<const FHitResult> HitResults, const TArrayView<AActor* const> TargetActors, const bool bUseMultiHitTargetData)
 {
-	for (const FHitResult& HitResult : HitResults)
+	FGSCTargetDataPool& Pool = FGSCTargetDataPool::Get();
+
+	if (bUseMultiHitTargetData)
+	{
+		if (HitResults.Num() > 0)
+		{
+			TargetData.Data.Add(Pool.AcquireMultiHit(HitResults));
+		}
+	}
+	else
 	{
-		FGameplayAbilityTargetData_SingleTargetHit* NewData = new FGameplayAbilityTargetData_SingleTargetHit(HitResult);
-		TargetData.Add(NewData);
+		for (const FHitResult& HitResult : HitResults)
+		{
+			TargetData.Data.Add(Pool.AcquireSingleTargetHit(HitResult));
+		}
 	}
 
 	if (TargetActors.Num() > 0)
 	{
-		FGameplayAbilityTargetData_ActorArray* NewData = new FGameplayAbilityTargetData_ActorArray();
-		NewData->TargetActorArray.Append(TargetActors);
-		TargetData.Add(NewData);
+		TargetData.Data.Add(Pool.AcquireActorArray(TargetActors));
 	}
 }
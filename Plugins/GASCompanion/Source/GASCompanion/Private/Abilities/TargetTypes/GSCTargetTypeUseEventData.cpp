@@ -2,21 +2,31 @@
 
 #include "Abilities/TargetTypes/GSCTargetTypeUseEventData.h"
 
-#include "AbilitySystemBlueprintLibrary.h"
 #include "Abilities/GameplayAbilityTypes.h"
 
 void UGSCTargetTypeUseEventData::GetTargets_Implementation(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const
+{
+	FGSCTargetHitResults HitResults;
+	FGSCTargetActors Actors;
+	GetTargetsNative(TargetingActor, EventData, HitResults, Actors);
+
+	OutHitResults.Append(HitResults);
+	OutActors.Append(Actors);
+}
+
+void UGSCTargetTypeUseEventData::GetTargetsNative(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const
 {
 	const FHitResult* FoundHitResult = EventData.ContextHandle.GetHitResult();
-	FHitResult TargetDataHitResult = UAbilitySystemBlueprintLibrary::GetHitResultFromTargetData(EventData.TargetData, 0);
+	const FGameplayAbilityTargetData* TargetData = EventData.TargetData.Get(0);
+	const FHitResult* TargetDataHitResult = TargetData ? TargetData->GetHitResult() : nullptr;
 
 	if (FoundHitResult)
 	{
 		OutHitResults.Add(*FoundHitResult);
 	}
-	else if (TargetDataHitResult.IsValidBlockingHit())
+	else if (TargetDataHitResult && TargetDataHitResult->IsValidBlockingHit())
 	{
-		OutHitResults.Add(TargetDataHitResult);
+		OutHitResults.Add(*TargetDataHitResult);
 	}
 	else if (EventData.Target)
 	{
@@ -8,3 +8,8 @@ void UGSCTargetTypeUseOwner::GetTargets_Implementation(AActor* TargetingActor, F
 {
 	OutActors.Add(TargetingActor);
 }
+
+void UGSCTargetTypeUseOwner::GetTargetsNative(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const
+{
+	OutActors.Add(TargetingActor);
+}
@@ -2,6 +2,7 @@
 
 #include "Abilities/Tasks/GSCAbilityTask_NetworkSyncPoint.h"
 #include "AbilitySystemComponent.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
 
 UGSCAbilityTask_NetworkSyncPoint::UGSCAbilityTask_NetworkSyncPoint(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer), SyncType()
@@ -41,7 +42,7 @@ void UGSCAbilityTask_NetworkSyncPoint::Activate()
 			if (SyncType != EGSCAbilityTaskNetSyncType::OnlyClientWait)
 			{
 				// As long as the server is waiting (!= OnlyClientWait), send the Server and RPC for this signal
-				AbilitySystemComponent->ServerSetReplicatedEvent(EAbilityGenericReplicatedEvent::GenericSignalFromClient, GetAbilitySpecHandle(), GetActivationPredictionKey(), AbilitySystemComponent->ScopedPredictionKey);
+				SendSignal(EAbilityGenericReplicatedEvent::GenericSignalFromClient);
 			}
 			
 		}
@@ -55,7 +56,7 @@ void UGSCAbilityTask_NetworkSyncPoint::Activate()
 			if (SyncType != EGSCAbilityTaskNetSyncType::OnlyServerWait)
 			{
 				// As long as the client is waiting (!= OnlyServerWait), send the Server and RPC for this signal
-				AbilitySystemComponent->ClientSetReplicatedEvent(EAbilityGenericReplicatedEvent::GenericSignalFromServer, GetAbilitySpecHandle(), GetActivationPredictionKey());
+				SendSignal(EAbilityGenericReplicatedEvent::GenericSignalFromServer);
 			}
 		}
 
@@ -71,6 +72,26 @@ void UGSCAbilityTask_NetworkSyncPoint::Activate()
 	}
 }
 
+void UGSCAbilityTask_NetworkSyncPoint::SendSignal(const EAbilityGenericReplicatedEvent::Type EventType) const
+{
+	// Multiplex through the companion ASC sync channel when possible, one RPC per frame for every sync point
+	if (UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent); ASC && UGSCAbilitySystemComponent::IsSyncChannelEnabled())
+	{
+		const FPredictionKey CurrentPredictionKey = EventType == EAbilityGenericReplicatedEvent::GenericSignalFromClient ? AbilitySystemComponent->ScopedPredictionKey : FPredictionKey();
+		ASC->QueueSyncPointSignal(EventType, GetAbilitySpecHandle(), GetActivationPredictionKey(), CurrentPredictionKey);
+		return;
+	}
+
+	if (EventType == EAbilityGenericReplicatedEvent::GenericSignalFromClient)
+	{
+		AbilitySystemComponent->ServerSetReplicatedEvent(EventType, GetAbilitySpecHandle(), GetActivationPredictionKey(), AbilitySystemComponent->ScopedPredictionKey);
+	}
+	else
+	{
+		AbilitySystemComponent->ClientSetReplicatedEvent(EventType, GetAbilitySpecHandle(), GetActivationPredictionKey());
+	}
+}
+
 void UGSCAbilityTask_NetworkSyncPoint::SyncFinished()
 {
 	if (IsValid(this))
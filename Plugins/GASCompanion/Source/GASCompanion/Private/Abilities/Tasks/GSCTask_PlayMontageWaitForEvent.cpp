@@ -6,6 +6,7 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
 #include "Abilities/Tasks/GSCAbilityTask_NetworkSyncPoint.h"
 #include "Animation/AnimInstance.h"
 #include "GameFramework/Character.h"
@@ -33,6 +34,13 @@ void UGSCTask_PlayMontageWaitForEvent::Activate()
             // Bind to event callback
             EventHandle = AbilitySystemComponent->AddGameplayEventTagContainerDelegate(EventTags, FGameplayEventTagMulticastDelegate::FDelegate::CreateUObject(this, &UGSCTask_PlayMontageWaitForEvent::OnGameplayEvent));
 
+            // Server side of coalesced sync, wait for the client batch signals
+            UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent);
+            if (bCoalesceServerSync && ASC && IsForRemoteClient())
+            {
+                SyncEventBatchHandle = ASC->OnSyncEventBatchReceived.AddUObject(this, &UGSCTask_PlayMontageWaitForEvent::OnSyncEventBatchReceived);
+            }
+
         	float CurrentMontageSectionTimeLeft = AbilitySystemComponent->GetCurrentMontageSectionTimeLeft();
             if (AbilitySystemComponent->PlayMontage(Ability, Ability->GetCurrentActivationInfo(), MontageToPlay, Rate, StartSection) > 0.f)
             {
@@ -103,7 +111,14 @@ FString UGSCTask_PlayMontageWaitForEvent::GetDebugString() const
         }
     }
 
-    return FString::Printf(TEXT("PlayMontageAndWaitForEvent. MontageToPlay: %s  (Currently Playing): %s"), *GetNameSafe(MontageToPlay), *GetNameSafe(PlayingMontage));
+    return FString::Printf(
+        TEXT("PlayMontageAndWaitForEvent. MontageToPlay: %s  (Currently Playing): %s, Events: %d, Sync Points: %d, Sync Batches: %d"),
+        *GetNameSafe(MontageToPlay),
+        *GetNameSafe(PlayingMontage),
+        NumEventsReceived,
+        NumSyncTasksCreated,
+        NumSyncBatchesSent
+    );
 }
 
 void UGSCTask_PlayMontageWaitForEvent::OnDestroy(const bool AbilityEnded)
@@ -126,6 +141,16 @@ void UGSCTask_PlayMontageWaitForEvent::OnDestroy(const bool AbilityEnded)
         AbilitySystemComponent->RemoveGameplayEventTagContainerDelegate(EventTags, EventHandle);
     }
 
+    if (UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent); ASC && SyncEventBatchHandle.IsValid())
+    {
+        ASC->OnSyncEventBatchReceived.Remove(SyncEventBatchHandle);
+        SyncEventBatchHandle.Reset();
+    }
+
+    PendingSyncEvents.Reset();
+
+    GSC_LOG(Verbose, TEXT("UGSCTask_PlayMontageWaitForEvent::OnDestroy - %s received %d events using %d sync points and %d sync batches (Coalesce: %s)"), *GetNameSafe(MontageToPlay), NumEventsReceived, NumSyncTasksCreated, NumSyncBatchesSent, bCoalesceServerSync ? TEXT("true") : TEXT("false"));
+
     Super::OnDestroy(AbilityEnded);
 }
 
@@ -136,7 +161,7 @@ void UGSCTask_PlayMontageWaitForEvent::UnbindAllDelegate()
     OnInterrupted.Clear();
 }
 
-UGSCTask_PlayMontageWaitForEvent* UGSCTask_PlayMontageWaitForEvent::PlayMontageAndWaitForEvent(UGameplayAbility* OwningAbility, FName TaskInstanceName, UAnimMontage* MontageToPlay, FGameplayTagContainer EventTags, float Rate, FName StartSection, bool bStopWhenAbilityEnds, float AnimRootMotionTranslationScale)
+UGSCTask_PlayMontageWaitForEvent* UGSCTask_PlayMontageWaitForEvent::PlayMontageAndWaitForEvent(UGameplayAbility* OwningAbility, FName TaskInstanceName, UAnimMontage* MontageToPlay, FGameplayTagContainer EventTags, float Rate, FName StartSection, bool bStopWhenAbilityEnds, float AnimRootMotionTranslationScale, bool bCoalesceServerSync)
 {
     UAbilitySystemGlobals::NonShipping_ApplyGlobalAbilityScaler_Rate(Rate);
 
@@ -155,6 +180,7 @@ UGSCTask_PlayMontageWaitForEvent* UGSCTask_PlayMontageWaitForEvent::PlayMontageA
     MyObj->StartSection = StartSection;
     MyObj->AnimRootMotionTranslationScale = AnimRootMotionTranslationScale;
     MyObj->bStopWhenAbilityEnds = bStopWhenAbilityEnds;
+    MyObj->bCoalesceServerSync = bCoalesceServerSync;
 
     return MyObj;
 }
@@ -254,18 +280,26 @@ void UGSCTask_PlayMontageWaitForEvent::OnMontageEnded(UAnimMontage* Montage, boo
     EndTask();
 }
 
-void UGSCTask_PlayMontageWaitForEvent::OnGameplayEvent(FGameplayTag EventTag, const FGameplayEventData* Payload) const
+void UGSCTask_PlayMontageWaitForEvent::OnGameplayEvent(const FGameplayTag EventTag, const FGameplayEventData* Payload)
 {
 	if (!ShouldBroadcastAbilityTaskDelegates())
 	{
 		return;
 	}
-	
+
+	NumEventsReceived++;
+
 	FGameplayEventData TempData = *Payload;
 	TempData.EventTag = EventTag;
 
+	if (bCoalesceServerSync && HandleCoalescedEvent(TempData))
+	{
+		return;
+	}
+
 	UGSCAbilityTask_NetworkSyncPoint* Task = UGSCAbilityTask_NetworkSyncPoint::WaitNetSync(Ability, EGSCAbilityTaskNetSyncType::OnlyServerWait);
-	
+	NumSyncTasksCreated++;
+
 	// Wait for execution synchronization and only trigger EventReceived when server is ready
 	Task->OnSyncDelegate.AddUObject(this, &UGSCTask_PlayMontageWaitForEvent::OnServerSyncEventReceived, EventTag, TempData);
 	Task->ReadyForActivation();
@@ -279,3 +313,60 @@ void UGSCTask_PlayMontageWaitForEvent::OnServerSyncEventReceived(const FGameplay
 	}
 }
 
+bool UGSCTask_PlayMontageWaitForEvent::HandleCoalescedEvent(const FGameplayEventData& EventData)
+{
+	UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent);
+	if (!ASC)
+	{
+		return false;
+	}
+
+	if (IsPredictingClient())
+	{
+		// Same as an OnlyServerWait sync point, signal the server and go on right away
+		if (ASC->QueueSyncEventBatchSignal(GetAbilitySpecHandle(), GetActivationPredictionKey(), ASC->ScopedPredictionKey))
+		{
+			NumSyncBatchesSent++;
+		}
+
+		EventReceived.Broadcast(EventData.EventTag, EventData);
+	}
+	else if (IsForRemoteClient())
+	{
+		// Held until a client batch signal releases it
+		PendingSyncEvents.Add(EventData);
+		DispatchConfirmedSyncEvents();
+	}
+	else
+	{
+		// Nothing to sync with (locally controlled on authority)
+		EventReceived.Broadcast(EventData.EventTag, EventData);
+	}
+
+	return true;
+}
+
+void UGSCTask_PlayMontageWaitForEvent::OnSyncEventBatchReceived(const FGameplayAbilitySpecHandle AbilityHandle, const FPredictionKey AbilityOriginalPredictionKey, const int32 NumEvents)
+{
+	if (AbilityHandle != GetAbilitySpecHandle() || !(AbilityOriginalPredictionKey == GetActivationPredictionKey()))
+	{
+		return;
+	}
+
+	NumConfirmedSyncEvents += NumEvents;
+	DispatchConfirmedSyncEvents();
+}
+
+void UGSCTask_PlayMontageWaitForEvent::DispatchConfirmedSyncEvents()
+{
+	// Events are received in the same order on both ends, the client batch size tells how many of them are released
+	while (NumConfirmedSyncEvents > 0 && PendingSyncEvents.Num() > 0 && ShouldBroadcastAbilityTaskDelegates())
+	{
+		// Copy out first, EventReceived handlers may trigger new events
+		const FGameplayEventData EventData = PendingSyncEvents[0];
+		PendingSyncEvents.RemoveAt(0, 1, false);
+		NumConfirmedSyncEvents--;
+
+		EventReceived.Broadcast(EventData.EventTag, EventData);
+	}
+}
@@ -6,16 +6,12 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Core/Debug/GSCInputLatencyTracker.h"
+#include "Subsystems/GSCInputIDSubsystem.h"
 
 namespace GSCAbilityInputBindingComponent_Impl
 {
-	constexpr int32 InvalidInputID = 0;
-	int32 IncrementingInputID = InvalidInputID;
-
-	static int32 GetNextInputID()
-	{
-		return ++IncrementingInputID;
-	}
+	constexpr int32 InvalidInputID = UGSCInputIDSubsystem::InvalidInputID;
 }
 
 void UGSCAbilityInputBindingComponent::SetupPlayerControls_Implementation(UEnhancedInputComponent* PlayerInputComponent)
@@ -63,6 +59,18 @@ void UGSCAbilityInputBindingComponent::ReleaseInputComponent(AController* OldCon
 	Super::ReleaseInputComponent();
 }
 
+void UGSCAbilityInputBindingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Give back any Input IDs we were holding so that they can be recycled by other components in this world
+	for (auto& InputBinding : MappedAbilities)
+	{
+		ReleaseInputID(InputBinding.Value.InputID);
+		InputBinding.Value.InputID = GSCAbilityInputBindingComponent_Impl::InvalidInputID;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UGSCAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction, const EGSCAbilityTriggerEvent TriggerEvent, const FGameplayAbilitySpecHandle AbilityHandle)
 {
 	using namespace GSCAbilityInputBindingComponent_Impl;
@@ -81,7 +89,7 @@ void UGSCAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction
 	else
 	{
 		AbilityInputBinding = &MappedAbilities.Add(InputAction);
-		AbilityInputBinding->InputID = GetNextInputID();
+		AbilityInputBinding->InputID = AcquireInputID();
 		AbilityInputBinding->TriggerEvent = TriggerEvent;
 	}
 
@@ -184,8 +192,8 @@ UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbilitySpe
 	UInputAction* FoundInputAction = nullptr;
 	for (const TTuple<UInputAction*, FGSCAbilityInputBinding>& MappedAbility : MappedAbilities)
 	{
-		const FGSCAbilityInputBinding AbilityInputBinding = MappedAbility.Value;
-		if (AbilityInputBinding.InputID == AbilitySpec->InputID)
+		const FGSCAbilityInputBinding& AbilityInputBinding = MappedAbility.Value;
+		if (AbilityInputBinding.InputID != GSCAbilityInputBindingComponent_Impl::InvalidInputID && AbilityInputBinding.InputID == AbilitySpec->InputID)
 		{
 			FoundInputAction = MappedAbility.Key;
 			break;
@@ -239,8 +247,13 @@ void UGSCAbilityInputBindingComponent::RunAbilitySystemSetup()
 	{
 		for (auto& InputBinding : MappedAbilities)
 		{
-			const int32 NewInputID = GSCAbilityInputBindingComponent_Impl::GetNextInputID();
-			InputBinding.Value.InputID = NewInputID;
+			// Keep the Input ID we were already holding, only acquire one if we don't have any (released on EndPlay)
+			if (InputBinding.Value.InputID == GSCAbilityInputBindingComponent_Impl::InvalidInputID)
+			{
+				InputBinding.Value.InputID = AcquireInputID();
+			}
+
+			const int32 NewInputID = InputBinding.Value.InputID;
 
 			for (const FGameplayAbilitySpecHandle AbilityHandle : InputBinding.Value.BoundAbilitiesStack)
 			{
@@ -301,6 +314,7 @@ void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* Input
 		const FGSCAbilityInputBinding* FoundBinding = MappedAbilities.Find(InputAction);
 		if (FoundBinding && ensure(FoundBinding->InputID != InvalidInputID))
 		{
+			GSC_INPUT_LATENCY_MARK(MarkInputPressed, AbilityComponent, FoundBinding->InputID)
 			AbilityComponent->AbilityLocalInputPressed(FoundBinding->InputID);
 		}
 	}
@@ -366,6 +380,7 @@ void UGSCAbilityInputBindingComponent::RemoveEntry(const UInputAction* InputActi
 			}
 		}
 
+		ReleaseInputID(Bindings->InputID);
 		MappedAbilities.Remove(InputAction);
 	}
 }
@@ -402,6 +417,31 @@ void UGSCAbilityInputBindingComponent::TryBindAbilityInput(UInputAction* InputAc
 	}
 }
 
+int32 UGSCAbilityInputBindingComponent::AcquireInputID() const
+{
+	UGSCInputIDSubsystem* InputIDSubsystem = UGSCInputIDSubsystem::Get(this);
+	if (!InputIDSubsystem)
+	{
+		GSC_LOG(Error, TEXT("UGSCAbilityInputBindingComponent::AcquireInputID - Unable to get InputID subsystem for %s (no world ?)"), *GetNameSafe(GetOwner()))
+		return GSCAbilityInputBindingComponent_Impl::InvalidInputID;
+	}
+
+	return InputIDSubsystem->AcquireInputID();
+}
+
+void UGSCAbilityInputBindingComponent::ReleaseInputID(const int32 InputID) const
+{
+	if (InputID == GSCAbilityInputBindingComponent_Impl::InvalidInputID)
+	{
+		return;
+	}
+
+	if (UGSCInputIDSubsystem* InputIDSubsystem = UGSCInputIDSubsystem::Get(this))
+	{
+		InputIDSubsystem->ReleaseInputID(InputID);
+	}
+}
+
 ETriggerEvent UGSCAbilityInputBindingComponent::GetInputActionTriggerEvent(const EGSCAbilityTriggerEvent TriggerEvent)
 {
 	return TriggerEvent == EGSCAbilityTriggerEvent::Started ? ETriggerEvent::Started :
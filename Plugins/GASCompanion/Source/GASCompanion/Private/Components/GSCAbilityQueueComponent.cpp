@@ -7,6 +7,7 @@
 #include "AbilitySystemComponent.h"
 #include "GSCDelegates.h"
 #include "Abilities/GSCGameplayAbility.h"
+#include "Core/Debug/GSCTrace.h"
 #include "UI/GSCUWDebugAbilityQueue.h"
 #include "GSCLog.h"
 
@@ -46,6 +47,12 @@ void UGSCAbilityQueueComponent::SetupOwner()
 	OwnerAbilitySystemComponent = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OwnerPawn);
 }
 
+void UGSCAbilityQueueComponent::SetAbilityQueueEnabled(const bool bEnabled)
+{
+	bAbilityQueueEnabled = bEnabled;
+	UpdateDebugWidgetQueueState();
+}
+
 void UGSCAbilityQueueComponent::OpenAbilityQueue()
 {
 	if (!bAbilityQueueEnabled)
@@ -54,6 +61,8 @@ void UGSCAbilityQueueComponent::OpenAbilityQueue()
 	}
 
 	bAbilityQueueOpened = true;
+	GSC_TRACE_EVENT(AbilityQueueOpened, GetOwner(), nullptr, FPredictionKey(), 0)
+	UpdateDebugWidgetQueueState();
 }
 
 void UGSCAbilityQueueComponent::CloseAbilityQueue()
@@ -69,6 +78,8 @@ void UGSCAbilityQueueComponent::CloseAbilityQueue()
 	}
 
 	bAbilityQueueOpened = false;
+	GSC_TRACE_EVENT(AbilityQueueClosed, GetOwner(), nullptr, FPredictionKey(), 0)
+	UpdateDebugWidgetQueueState();
 }
 
 void UGSCAbilityQueueComponent::UpdateAllowedAbilitiesForAbilityQueue(TArray<TSubclassOf<UGameplayAbility>> AllowedAbilities)
@@ -94,6 +105,7 @@ void UGSCAbilityQueueComponent::SetAllowAllAbilitiesForAbilityQueue(const bool b
 	bAllowAllAbilitiesForAbilityQueue = bAllowAllAbilities;
 
 	UpdateDebugWidgetAllowedAbilities();
+	UpdateDebugWidgetQueueState();
 }
 
 bool UGSCAbilityQueueComponent::IsAbilityQueueOpened() const
@@ -160,6 +172,7 @@ void UGSCAbilityQueueComponent::OnAbilityEnded(const UGameplayAbility* InAbility
 				ResetAbilityQueueState();
 
 				GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() %s is within Allowed Abilties, try activate [AbilityQueueSystem]"), *AbilityToActivate->GetName())
+				GSC_TRACE_EVENT(AbilityQueueConsumed, GetOwner(), AbilityToActivate, FPredictionKey(), 0)
 				if (OwnerAbilitySystemComponent)
 				{
 					OwnerAbilitySystemComponent->TryActivateAbilityByClass(AbilityToActivate->GetClass());
@@ -189,6 +202,7 @@ void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability,
 		if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(Ability->GetClass()))
 		{
 			QueuedAbility = Ability;
+			UpdateDebugWidgetQueueState();
 		}
 	}
 }
@@ -202,9 +216,15 @@ void UGSCAbilityQueueComponent::ResetAbilityQueueState()
 
 	// Notify Debug Widget if any is on screen
 	UpdateDebugWidgetAllowedAbilities();
+	UpdateDebugWidgetQueueState();
 }
 
 void UGSCAbilityQueueComponent::UpdateDebugWidgetAllowedAbilities()
 {
 	FGSCDelegates::OnUpdateAllowedAbilities.Broadcast(QueuedAllowedAbilities);
 }
+
+void UGSCAbilityQueueComponent::UpdateDebugWidgetQueueState()
+{
+	FGSCDelegates::OnAbilityQueueStateChanged.Broadcast(this);
+}
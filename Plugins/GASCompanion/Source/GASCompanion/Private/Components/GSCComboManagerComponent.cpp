@@ -7,6 +7,7 @@
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility_MeleeBase.h"
 #include "Components/GSCCoreComponent.h"
+#include "Core/Debug/GSCTrace.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
@@ -36,6 +37,7 @@ void UGSCComboManagerComponent::IncrementCombo()
 	if (bComboWindowOpened)
 	{
 		ComboIndex = ComboIndex + 1;
+		GSC_TRACE_EVENT(ComboIndexChanged, GetOwner(), MeleeBaseAbility.Get(), FPredictionKey(), ComboIndex)
 	}
 }
 
@@ -59,6 +61,8 @@ void UGSCComboManagerComponent::ActivateComboAbility(const TSubclassOf<UGSCGamep
 
 void UGSCComboManagerComponent::SetComboIndex(const int32 InComboIndex)
 {
+	GSC_TRACE_EVENT(ComboIndexChanged, GetOwner(), MeleeBaseAbility.Get(), FPredictionKey(), InComboIndex)
+
 	if (IsOwnerActorAuthoritative())
 	{
 		ComboIndex = InComboIndex;
@@ -182,6 +186,7 @@ void UGSCComboManagerComponent::MulticastSetComboIndex_Implementation(const int3
 	if (OwningCharacter && !OwningCharacter->IsLocallyControlled())
 	{
 		ComboIndex = InComboIndex;
+		GSC_TRACE_EVENT(ComboIndexChanged, GetOwner(), MeleeBaseAbility.Get(), FPredictionKey(), ComboIndex)
 	}
 }
 
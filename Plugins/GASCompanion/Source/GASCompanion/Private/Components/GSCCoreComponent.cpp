@@ -7,9 +7,11 @@
 #include "AbilitySystemComponent.h"
 #include "Abilities/GSCGameplayAbility.h"
 #include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Core/Debug/GSCTrace.h"
 #include "Core/Settings/GSCDeveloperSettings.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
 
 // Sets default values for this component's properties
 UGSCCoreComponent::UGSCCoreComponent()
@@ -58,6 +60,7 @@ void UGSCCoreComponent::SetupOwner()
 
 void UGSCCoreComponent::RegisterAbilitySystemDelegates(UAbilitySystemComponent* ASC)
 {
+	LLM_SCOPE_BYTAG(GASCompanion);
 	GSC_LOG(Log, TEXT("UGSCCoreComponent::RegisterAbilitySystemDelegates for ASC: %s"), ASC ? *ASC->GetName() : TEXT("NONE"))
 
 	if (!ASC)
@@ -140,8 +143,15 @@ void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent*
 	}
 }
 
+SIZE_T UGSCCoreComponent::GetAllocatedSize() const
+{
+	return GameplayEffectAddedHandles.GetAllocatedSize() + GameplayTagBoundToDelegates.GetAllocatedSize();
+}
+
 void UGSCCoreComponent::HandleDamage(const float DamageAmount, const FGameplayTagContainer& DamageTags, AActor* SourceActor)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnDamage.Broadcast(DamageAmount, SourceActor, DamageTags);
 
 	// TODO: Damage Attribute not replicated, have to figure out a way to broadcast to clients (mostly to keep SourceActor)
@@ -157,7 +167,13 @@ void UGSCCoreComponent::HandleHealthChange(const float DeltaValue, const FGamepl
 		return;
 	}
 
-	OnHealthChange.Broadcast(DeltaValue, EventTags);
+	{
+		// Scoped to the broadcast only, Die has its own scope
+		GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+		GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
+		OnHealthChange.Broadcast(DeltaValue, EventTags);
+	}
+
 	if (!IsAlive())
 	{
 		Die();
@@ -166,39 +182,49 @@ void UGSCCoreComponent::HandleHealthChange(const float DeltaValue, const FGamepl
 
 void UGSCCoreComponent::HandleStaminaChange(const float DeltaValue, const FGameplayTagContainer& EventTags)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	// We only call the BP callbacks if this is not the initial ability setup
 	if (!bStartupAbilitiesGranted)
 	{
 		return;
 	}
 
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnStaminaChange.Broadcast(DeltaValue, EventTags);
 }
 
 void UGSCCoreComponent::HandleManaChange(const float DeltaValue, const FGameplayTagContainer& EventTags)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	// We only call the BP callbacks if this is not the initial ability setup
 	if (!bStartupAbilitiesGranted)
 	{
 		return;
 	}
 
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnManaChange.Broadcast(DeltaValue, EventTags);
 }
 
 void UGSCCoreComponent::HandleAttributeChange(const FGameplayAttribute Attribute, const float DeltaValue, const FGameplayTagContainer& EventTags)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnAttributeChange.Broadcast(Attribute, DeltaValue, EventTags);
 }
 
 void UGSCCoreComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	const float NewValue = Data.NewValue;
 	const float OldValue = Data.OldValue;
 
 	// Prevent broadcast Attribute changes if New and Old values are the same
-	// most likely because of clamping in post gameplay effect execute
-	if (OldValue == NewValue)
+	// most likely because of clamping in post gameplay effect execute, or if nobody is listening (eg. AI crowds)
+	if (OldValue == NewValue || !OnAttributeChange.IsBound())
 	{
 		return;
 	}
@@ -211,6 +237,7 @@ void UGSCCoreComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
 	}
 
 	// Broadcast attribute change to component
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnAttributeChange.Broadcast(Data.Attribute, NewValue - OldValue, SourceTags);
 }
 
@@ -222,6 +249,8 @@ void UGSCCoreComponent::OnDamageAttributeChanged(const FOnAttributeChangeData& D
 
 void UGSCCoreComponent::Die()
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnDeath.Broadcast();
 }
 
@@ -295,9 +324,7 @@ float UGSCCoreComponent::GetAttributeValue(const FGameplayAttribute Attribute) c
 
 	if (!OwnerAbilitySystemComponent->HasAttributeSetForAttribute(Attribute))
 	{
-		const UObject* Owner = Cast<UObject>(this);
-		const FString OwnerName = OwnerActor ? OwnerActor->GetName() : Owner->GetName();
-		GSC_LOG(Warning, TEXT("GetAttributeValue() Attribute %s doesn't seem to be part of the AttributeSet attached to %s"), *Attribute.GetName(), *OwnerName)
+		GSC_LOG(Warning, TEXT("GetAttributeValue() Attribute %s doesn't seem to be part of the AttributeSet attached to %s"), *Attribute.GetName(), *GetNameSafe(OwnerActor ? static_cast<const UObject*>(OwnerActor) : this))
 		return 0.0f;
 	}
 
@@ -313,9 +340,7 @@ float UGSCCoreComponent::GetCurrentAttributeValue(const FGameplayAttribute Attri
 
 	if (!OwnerAbilitySystemComponent->HasAttributeSetForAttribute(Attribute))
 	{
-		const UObject* Owner = Cast<UObject>(this);
-		const FString OwnerName = OwnerActor ? OwnerActor->GetName() : Owner->GetName();
-		GSC_LOG(Warning, TEXT("GetCurrentAttributeValue() Attribute %s doesn't seem to be part of the AttributeSet attached to %s"), *Attribute.GetName(), *OwnerName)
+		GSC_LOG(Warning, TEXT("GetCurrentAttributeValue() Attribute %s doesn't seem to be part of the AttributeSet attached to %s"), *Attribute.GetName(), *GetNameSafe(OwnerActor ? static_cast<const UObject*>(OwnerActor) : this))
 		return 0.0f;
 	}
 
@@ -602,11 +627,15 @@ void UGSCCoreComponent::AdjustAttributeForMaxChange(UGSCAttributeSetBase* Attrib
 
 void UGSCCoreComponent::PreAttributeChange(UGSCAttributeSetBase* AttributeSet, const FGameplayAttribute& Attribute, const float NewValue)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnPreAttributeChange.Broadcast(AttributeSet, Attribute, NewValue);
 }
 
 void UGSCCoreComponent::PostGameplayEffectExecute(UGSCAttributeSetBase* AttributeSet, const FGameplayEffectModCallbackData& Data)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (!AttributeSet)
 	{
 		GSC_LOG(Error, TEXT("UGSCCoreComponent:PostGameplayEffectExecute() Owner AttributeSet isn't valid"));
@@ -637,6 +666,7 @@ void UGSCCoreComponent::PostGameplayEffectExecute(UGSCAttributeSetBase* Attribut
 	Payload.AbilitySystemComponent = AttributeSet->GetOwningAbilitySystemComponent();
 	Payload.DeltaValue = DeltaValue;
 	Payload.ClampMinimumValue = ClampMinimumValue;
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnPostGameplayEffectExecute.Broadcast(Data.EvaluatedData.Attribute, SourceActor, TargetActor, SourceTags, Payload);
 }
 
@@ -647,6 +677,8 @@ void UGSCCoreComponent::SetStartupAbilitiesGranted(const bool bGranted)
 
 void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& SpecApplied, const FActiveGameplayEffectHandle ActiveHandle)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (!OwnerAbilitySystemComponent)
 	{
 		return;
@@ -658,6 +690,9 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 	FGameplayTagContainer GrantedTags;
 	SpecApplied.GetAllGrantedTags(GrantedTags);
 
+	GSC_TRACE_EVENT(EffectAdded, GetOwner(), SpecApplied.Def, Target->ScopedPredictionKey, SpecApplied.StackCount)
+
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnGameplayEffectAdded.Broadcast(AssetTags, GrantedTags, ActiveHandle);
 
 	OwnerAbilitySystemComponent->OnGameplayEffectStackChangeDelegate(ActiveHandle)->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectStackChanged);
@@ -669,6 +704,8 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 
 void UGSCCoreComponent::OnActiveGameplayEffectStackChanged(const FActiveGameplayEffectHandle ActiveHandle, const int32 NewStackCount, const int32 PreviousStackCount)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (!OwnerAbilitySystemComponent)
 	{
 		return;
@@ -686,11 +723,16 @@ void UGSCCoreComponent::OnActiveGameplayEffectStackChanged(const FActiveGameplay
 	FGameplayTagContainer GrantedTags;
 	GameplayEffect->Spec.GetAllGrantedTags(GrantedTags);
 
+	GSC_TRACE_EVENT(EffectStackChanged, GetOwner(), GameplayEffect->Spec.Def, GameplayEffect->PredictionKey, NewStackCount)
+
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnGameplayEffectStackChange.Broadcast(AssetTags, GrantedTags, ActiveHandle, NewStackCount, PreviousStackCount);
 }
 
 void UGSCCoreComponent::OnActiveGameplayEffectTimeChanged(const FActiveGameplayEffectHandle ActiveHandle, const float NewStartTime, const float NewDuration)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (!OwnerAbilitySystemComponent)
 	{
 		return;
@@ -708,11 +750,14 @@ void UGSCCoreComponent::OnActiveGameplayEffectTimeChanged(const FActiveGameplayE
 	FGameplayTagContainer GrantedTags;
 	GameplayEffect->Spec.GetAllGrantedTags(GrantedTags);
 
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnGameplayEffectTimeChange.Broadcast(AssetTags, GrantedTags, ActiveHandle, NewStartTime, NewDuration);
 }
 
 void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect& EffectRemoved)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (!OwnerAbilitySystemComponent)
 	{
 		return;
@@ -724,23 +769,37 @@ void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect&
 	FGameplayTagContainer GrantedTags;
 	EffectRemoved.Spec.GetAllGrantedTags(GrantedTags);
 
+	GSC_TRACE_EVENT(EffectRemoved, GetOwner(), EffectRemoved.Spec.Def, EffectRemoved.PredictionKey, EffectRemoved.Spec.StackCount)
+
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnGameplayEffectStackChange.Broadcast(AssetTags, GrantedTags, EffectRemoved.Handle, 0, 1);
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnGameplayEffectRemoved.Broadcast(AssetTags, GrantedTags, EffectRemoved.Handle);
 }
 
 void UGSCCoreComponent::OnAnyGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount) const
 {
+	if (!OnGameplayTagChange.IsBound())
+	{
+		return;
+	}
+
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnGameplayTagChange.Broadcast(GameplayTag, NewCount);
 }
 
 void UGSCCoreComponent::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (!ActivatedAbility)
 	{
 		return;
 	}
 
 	// Trigger AbilityCommit event
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnAbilityCommit.Broadcast(ActivatedAbility);
 
 	HandleCooldownOnAbilityCommit(ActivatedAbility);
@@ -748,6 +807,8 @@ void UGSCCoreComponent::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
 
 void UGSCCoreComponent::OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount, const FGameplayAbilitySpecHandle AbilitySpecHandle, const float Duration)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_CoreComponentBroadcast);
+
 	if (NewCount != 0)
 	{
 		return;
@@ -770,6 +831,7 @@ void UGSCCoreComponent::OnCooldownGameplayTagChanged(const FGameplayTag Gameplay
 	// Broadcast cooldown expiration to BP
 	if (IsValid(Ability))
 	{
+		GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 		OnCooldownEnd.Broadcast(Ability, GameplayTag, Duration);
 	}
 
@@ -778,6 +840,7 @@ void UGSCCoreComponent::OnCooldownGameplayTagChanged(const FGameplayTag Gameplay
 
 void UGSCCoreComponent::HandleCooldownOnAbilityCommit(UGameplayAbility* ActivatedAbility)
 {
+	// Only called from OnAbilityCommitted, already within STAT_GSC_CoreComponentBroadcast scope
 	if (!OwnerAbilitySystemComponent)
 	{
 		return;
@@ -814,6 +877,7 @@ void UGSCCoreComponent::HandleCooldownOnAbilityCommit(UGameplayAbility* Activate
 	float Duration = 0.f;
 	ActivatedAbility->GetCooldownTimeRemainingAndDuration(AbilitySpecHandle, &ActorInfo, TimeRemaining, Duration);
 
+	GSC_INC_COUNTER(STAT_GSC_NumDelegateBroadcasts);
 	OnCooldownStart.Broadcast(ActivatedAbility, *CooldownTags, TimeRemaining, Duration);
 
 	// Register delegate to monitor any change to cooldown gameplay tag to be able to figure out when a cooldown expires
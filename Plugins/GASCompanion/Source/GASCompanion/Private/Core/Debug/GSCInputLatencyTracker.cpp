@@ -0,0 +1,453 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Core/Debug/GSCInputLatencyTracker.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "GSCLog.h"
+
+namespace GSCInputLatencyTracker_Impl
+{
+	/** Presses not activated within this delay are dropped (covers combo windows and ability queue) */
+	constexpr double PendingPressTimeout = 2.0;
+
+	/** Predicted activations not confirmed nor rejected by the server within this delay are dropped (lost RPCs, disconnects) */
+	constexpr double ConfirmationTimeout = 5.0;
+
+	/** Number of completed presses kept around for CSV export */
+	constexpr int32 MaxCompletedPresses = 512;
+
+	static int32 bEnabled = 0;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("GASCompanion.Latency.Enabled"),
+		bEnabled,
+		TEXT("Enable recording of input to ability activation latency (0 = off, 1 = on)"),
+		ECVF_Default
+	);
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("GASCompanion.Latency.Dump"),
+		TEXT("Prints per ability input to activation latency (Local, Predicted and ServerConfirmed)"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			FGSCInputLatencyTracker::Get().Dump(Ar);
+		})
+	);
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("GASCompanion.Latency.Reset"),
+		TEXT("Clears all recorded input to ability activation latency data"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FGSCInputLatencyTracker::Get().Reset();
+		})
+	);
+
+	static FAutoConsoleCommand ExportCommand(
+		TEXT("GASCompanion.Latency.ExportCSV"),
+		TEXT("Writes recorded input to ability activation latency as CSV. Optional argument: filename (defaults to Saved/Profiling/GASCompanion/InputLatency-<timestamp>.csv)"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString Filename = Args.Num() > 0 ?
+				Args[0] :
+				FPaths::ProfilingDir() / TEXT("GASCompanion") / FString::Printf(TEXT("InputLatency-%s.csv"), *FDateTime::Now().ToString());
+
+			FGSCInputLatencyTracker::Get().ExportCSV(Filename);
+		})
+	);
+}
+
+const float FGSCLatencyHistogram::BucketUpperBoundsMs[NumBuckets - 1] = { 1.f, 2.f, 4.f, 8.f, 16.f, 33.f, 50.f, 66.f, 100.f, 150.f, 200.f, 300.f, 500.f };
+
+void FGSCLatencyHistogram::AddSample(const double LatencyMs)
+{
+	int32 BucketIndex = 0;
+	while (BucketIndex < NumBuckets - 1 && LatencyMs > BucketUpperBoundsMs[BucketIndex])
+	{
+		BucketIndex++;
+	}
+
+	Buckets[BucketIndex]++;
+	MinMs = Count == 0 ? LatencyMs : FMath::Min(MinMs, LatencyMs);
+	MaxMs = Count == 0 ? LatencyMs : FMath::Max(MaxMs, LatencyMs);
+	SumMs += LatencyMs;
+	Count++;
+}
+
+double FGSCLatencyHistogram::GetAverageMs() const
+{
+	return Count > 0 ? SumMs / Count : 0.0;
+}
+
+double FGSCLatencyHistogram::GetPercentileMs(const float Percentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const int32 Target = FMath::CeilToInt(Count * FMath::Clamp(Percentile, 0.f, 1.f));
+	int32 Accumulated = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets - 1; BucketIndex++)
+	{
+		Accumulated += Buckets[BucketIndex];
+		if (Accumulated >= Target)
+		{
+			return FMath::Min<double>(BucketUpperBoundsMs[BucketIndex], MaxMs);
+		}
+	}
+
+	return MaxMs;
+}
+
+FGSCInputLatencyTracker& FGSCInputLatencyTracker::Get()
+{
+	static FGSCInputLatencyTracker Instance;
+	return Instance;
+}
+
+bool FGSCInputLatencyTracker::IsEnabled()
+{
+	return GSCInputLatencyTracker_Impl::bEnabled != 0;
+}
+
+void FGSCInputLatencyTracker::MarkInputPressed(const UAbilitySystemComponent* AbilitySystemComponent, const int32 InputID)
+{
+	const double Now = FPlatformTime::Seconds();
+	ExpirePendingPresses(Now);
+
+	FPressRecord& Record = PendingPresses.AddDefaulted_GetRef();
+	Record.AbilitySystemComponent = AbilitySystemComponent;
+	Record.InputID = InputID;
+	Record.PressedTime = Now;
+}
+
+void FGSCInputLatencyTracker::MarkInputDispatched(const UAbilitySystemComponent* AbilitySystemComponent, const int32 InputID, const UGameplayAbility* Ability, const bool bRoutedToCombo)
+{
+	// Most recent press for this input that wasn't dispatched yet
+	for (int32 Index = PendingPresses.Num() - 1; Index >= 0; --Index)
+	{
+		FPressRecord& Record = PendingPresses[Index];
+		if (Record.AbilitySystemComponent == AbilitySystemComponent && Record.InputID == InputID && Record.DispatchedTime == 0.0)
+		{
+			Record.DispatchedTime = FPlatformTime::Seconds();
+			Record.AbilityName = Ability ? Ability->GetClass()->GetFName() : NAME_None;
+			Record.bRoutedToCombo = bRoutedToCombo;
+			return;
+		}
+	}
+}
+
+void FGSCInputLatencyTracker::MarkAbilityActivated(const UAbilitySystemComponent* AbilitySystemComponent, const UGameplayAbility* Ability)
+{
+	// Expire first, activations also age out presses awaiting server confirmation even when none is pending
+	const double Now = FPlatformTime::Seconds();
+	ExpirePendingPresses(Now);
+
+	if (!Ability || PendingPresses.Num() == 0)
+	{
+		return;
+	}
+
+	const FName AbilityName = Ability->GetClass()->GetFName();
+
+	// Match on ability class first (direct activation or ability queue), then fallback to the oldest press routed to the combo
+	// component, as combo abilities may activate a different class than the one bound to the input.
+	int32 FoundIndex = PendingPresses.IndexOfByPredicate([AbilitySystemComponent, AbilityName](const FPressRecord& Record)
+	{
+		return Record.AbilitySystemComponent == AbilitySystemComponent && Record.AbilityName == AbilityName;
+	});
+
+	if (FoundIndex == INDEX_NONE)
+	{
+		FoundIndex = PendingPresses.IndexOfByPredicate([AbilitySystemComponent](const FPressRecord& Record)
+		{
+			return Record.AbilitySystemComponent == AbilitySystemComponent && Record.bRoutedToCombo;
+		});
+	}
+
+	if (FoundIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FPressRecord Record = PendingPresses[FoundIndex];
+	PendingPresses.RemoveAt(FoundIndex, 1, false);
+
+	Record.AbilityName = AbilityName;
+	Record.ActivatedTime = Now;
+
+	FAbilityLatencyStats& AbilityStats = Stats.FindOrAdd(AbilityName);
+	const double LatencyMs = (Now - Record.PressedTime) * 1000.0;
+
+	const FGameplayAbilityActivationInfo& ActivationInfo = Ability->GetCurrentActivationInfo();
+	switch (ActivationInfo.ActivationMode)
+	{
+	case EGameplayAbilityActivationMode::Predicting:
+		{
+			AbilityStats.Histograms[static_cast<int32>(EGSCInputLatencyCategory::Predicted)].AddSample(LatencyMs);
+			Record.bPredicted = true;
+
+			// Wait for the server to either catch up with or reject this prediction key
+			FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+			if (PredictionKey.IsValidKey())
+			{
+				AwaitingConfirmation.Add(PredictionKey.Current, Record);
+				PredictionKey.NewCaughtUpDelegate().BindStatic(&FGSCInputLatencyTracker::HandlePredictionKeyCaughtUp, PredictionKey.Current);
+				PredictionKey.NewRejectedDelegate().BindStatic(&FGSCInputLatencyTracker::HandlePredictionKeyRejected, PredictionKey.Current);
+				return;
+			}
+			break;
+		}
+	case EGameplayAbilityActivationMode::NonAuthority:
+	case EGameplayAbilityActivationMode::Confirmed:
+		// Activation was initiated (or already confirmed) by the server
+		Record.ConfirmedTime = Now;
+		AbilityStats.Histograms[static_cast<int32>(EGSCInputLatencyCategory::ServerConfirmed)].AddSample(LatencyMs);
+		break;
+	default:
+		AbilityStats.Histograms[static_cast<int32>(EGSCInputLatencyCategory::Local)].AddSample(LatencyMs);
+		break;
+	}
+
+	AddCompletedPress(Record);
+}
+
+void FGSCInputLatencyTracker::MarkAbilityFailed(const UAbilitySystemComponent* AbilitySystemComponent, const UGameplayAbility* Ability)
+{
+	if (!Ability)
+	{
+		return;
+	}
+
+	ExpirePendingPresses(FPlatformTime::Seconds());
+
+	const FName AbilityName = Ability->GetClass()->GetFName();
+	for (FPressRecord& Record : PendingPresses)
+	{
+		if (Record.AbilitySystemComponent == AbilitySystemComponent && Record.AbilityName == AbilityName && Record.FailedTime == 0.0)
+		{
+			Record.FailedTime = FPlatformTime::Seconds();
+			Stats.FindOrAdd(AbilityName).NumFailed++;
+			return;
+		}
+	}
+}
+
+void FGSCInputLatencyTracker::Reset()
+{
+	PendingPresses.Reset();
+	AwaitingConfirmation.Reset();
+	CompletedPresses.Reset();
+	CompletedPressesHead = 0;
+	Stats.Reset();
+}
+
+void FGSCInputLatencyTracker::Dump(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("GAS Companion input latency (%d abilities, %d pending presses, enabled: %s)"), Stats.Num(), PendingPresses.Num(), IsEnabled() ? TEXT("true") : TEXT("false"));
+
+	for (const TPair<FName, FAbilityLatencyStats>& Pair : Stats)
+	{
+		Ar.Logf(
+			TEXT("  %s - Failed: %d, Rejected: %d, Expired: %d"),
+			*Pair.Key.ToString(),
+			Pair.Value.NumFailed,
+			Pair.Value.NumRejected,
+			Pair.Value.NumExpired
+		);
+
+		for (int32 CategoryIndex = 0; CategoryIndex < static_cast<int32>(EGSCInputLatencyCategory::MAX); CategoryIndex++)
+		{
+			const FGSCLatencyHistogram& Histogram = Pair.Value.Histograms[CategoryIndex];
+			if (Histogram.Count == 0)
+			{
+				continue;
+			}
+
+			Ar.Logf(
+				TEXT("    %-16s Count: %5d, Avg: %7.2f ms, Min: %7.2f ms, P50: %7.2f ms, P95: %7.2f ms, Max: %7.2f ms"),
+				GetCategoryName(static_cast<EGSCInputLatencyCategory>(CategoryIndex)),
+				Histogram.Count,
+				Histogram.GetAverageMs(),
+				Histogram.MinMs,
+				Histogram.GetPercentileMs(0.5f),
+				Histogram.GetPercentileMs(0.95f),
+				Histogram.MaxMs
+			);
+		}
+	}
+}
+
+bool FGSCInputLatencyTracker::ExportCSV(const FString& Filename) const
+{
+	// Summary, one row per ability and category
+	FString Summary = TEXT("Ability,Category,Count,Failed,Rejected,Expired,AvgMs,MinMs,P50Ms,P95Ms,MaxMs");
+	for (int32 BucketIndex = 0; BucketIndex < FGSCLatencyHistogram::NumBuckets; BucketIndex++)
+	{
+		Summary += BucketIndex < FGSCLatencyHistogram::NumBuckets - 1 ?
+			FString::Printf(TEXT(",Le%.0fms"), FGSCLatencyHistogram::BucketUpperBoundsMs[BucketIndex]) :
+			TEXT(",Over");
+	}
+	Summary += LINE_TERMINATOR;
+
+	for (const TPair<FName, FAbilityLatencyStats>& Pair : Stats)
+	{
+		for (int32 CategoryIndex = 0; CategoryIndex < static_cast<int32>(EGSCInputLatencyCategory::MAX); CategoryIndex++)
+		{
+			const FGSCLatencyHistogram& Histogram = Pair.Value.Histograms[CategoryIndex];
+			Summary += FString::Printf(
+				TEXT("%s,%s,%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f"),
+				*Pair.Key.ToString(),
+				GetCategoryName(static_cast<EGSCInputLatencyCategory>(CategoryIndex)),
+				Histogram.Count,
+				Pair.Value.NumFailed,
+				Pair.Value.NumRejected,
+				Pair.Value.NumExpired,
+				Histogram.GetAverageMs(),
+				Histogram.MinMs,
+				Histogram.GetPercentileMs(0.5f),
+				Histogram.GetPercentileMs(0.95f),
+				Histogram.MaxMs
+			);
+
+			for (const int32 BucketCount : Histogram.Buckets)
+			{
+				Summary += FString::Printf(TEXT(",%d"), BucketCount);
+			}
+			Summary += LINE_TERMINATOR;
+		}
+	}
+
+	// Raw lifecycle markers for the last completed presses, relative to press time
+	FString Presses = TEXT("Ability,InputID,RoutedToCombo,Predicted,PressedTime,DispatchedMs,FailedMs,ActivatedMs,ConfirmedMs");
+	Presses += LINE_TERMINATOR;
+
+	auto GetRelativeMs = [](const FPressRecord& Record, const double Time)
+	{
+		return Time > 0.0 ? (Time - Record.PressedTime) * 1000.0 : -1.0;
+	};
+
+	for (int32 Offset = 0; Offset < CompletedPresses.Num(); Offset++)
+	{
+		const FPressRecord& Record = CompletedPresses[(CompletedPressesHead + Offset) % CompletedPresses.Num()];
+		Presses += FString::Printf(
+			TEXT("%s,%d,%d,%d,%.6f,%.3f,%.3f,%.3f,%.3f"),
+			*Record.AbilityName.ToString(),
+			Record.InputID,
+			Record.bRoutedToCombo ? 1 : 0,
+			Record.bPredicted ? 1 : 0,
+			Record.PressedTime,
+			GetRelativeMs(Record, Record.DispatchedTime),
+			GetRelativeMs(Record, Record.FailedTime),
+			GetRelativeMs(Record, Record.ActivatedTime),
+			GetRelativeMs(Record, Record.ConfirmedTime)
+		);
+		Presses += LINE_TERMINATOR;
+	}
+
+	const FString PressesFilename = FPaths::GetBaseFilename(Filename, false) + TEXT("-Presses.csv");
+	const bool bSuccess = FFileHelper::SaveStringToFile(Summary, *Filename) && FFileHelper::SaveStringToFile(Presses, *PressesFilename);
+	if (bSuccess)
+	{
+		GSC_LOG(Display, TEXT("FGSCInputLatencyTracker::ExportCSV - Wrote %s and %s"), *Filename, *PressesFilename)
+	}
+	else
+	{
+		GSC_LOG(Error, TEXT("FGSCInputLatencyTracker::ExportCSV - Failed to write %s"), *Filename)
+	}
+
+	return bSuccess;
+}
+
+void FGSCInputLatencyTracker::ExpirePendingPresses(const double Now)
+{
+	for (int32 Index = PendingPresses.Num() - 1; Index >= 0; --Index)
+	{
+		const FPressRecord& Record = PendingPresses[Index];
+		if (Now - Record.PressedTime > GSCInputLatencyTracker_Impl::PendingPressTimeout)
+		{
+			if (!Record.AbilityName.IsNone())
+			{
+				Stats.FindOrAdd(Record.AbilityName).NumExpired++;
+			}
+
+			PendingPresses.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	for (auto It = AwaitingConfirmation.CreateIterator(); It; ++It)
+	{
+		const FPressRecord& Record = It.Value();
+		if (Now - Record.ActivatedTime > GSCInputLatencyTracker_Impl::ConfirmationTimeout)
+		{
+			Stats.FindOrAdd(Record.AbilityName).NumExpired++;
+			AddCompletedPress(Record);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FGSCInputLatencyTracker::AddCompletedPress(const FPressRecord& Record)
+{
+	if (CompletedPresses.Num() < GSCInputLatencyTracker_Impl::MaxCompletedPresses)
+	{
+		CompletedPresses.Add(Record);
+		return;
+	}
+
+	CompletedPresses[CompletedPressesHead] = Record;
+	CompletedPressesHead = (CompletedPressesHead + 1) % CompletedPresses.Num();
+}
+
+void FGSCInputLatencyTracker::OnPredictionKeyCaughtUp(const FPredictionKey::KeyType PredictionKey)
+{
+	FPressRecord Record;
+	if (AwaitingConfirmation.RemoveAndCopyValue(PredictionKey, Record))
+	{
+		Record.ConfirmedTime = FPlatformTime::Seconds();
+
+		const double LatencyMs = (Record.ConfirmedTime - Record.PressedTime) * 1000.0;
+		Stats.FindOrAdd(Record.AbilityName).Histograms[static_cast<int32>(EGSCInputLatencyCategory::ServerConfirmed)].AddSample(LatencyMs);
+		AddCompletedPress(Record);
+	}
+}
+
+void FGSCInputLatencyTracker::OnPredictionKeyRejected(const FPredictionKey::KeyType PredictionKey)
+{
+	FPressRecord Record;
+	if (AwaitingConfirmation.RemoveAndCopyValue(PredictionKey, Record))
+	{
+		Stats.FindOrAdd(Record.AbilityName).NumRejected++;
+		AddCompletedPress(Record);
+	}
+}
+
+void FGSCInputLatencyTracker::HandlePredictionKeyCaughtUp(const FPredictionKey::KeyType PredictionKey)
+{
+	Get().OnPredictionKeyCaughtUp(PredictionKey);
+}
+
+void FGSCInputLatencyTracker::HandlePredictionKeyRejected(const FPredictionKey::KeyType PredictionKey)
+{
+	Get().OnPredictionKeyRejected(PredictionKey);
+}
+
+const TCHAR* FGSCInputLatencyTracker::GetCategoryName(const EGSCInputLatencyCategory Category)
+{
+	switch (Category)
+	{
+	case EGSCInputLatencyCategory::Local:
+		return TEXT("Local");
+	case EGSCInputLatencyCategory::Predicted:
+		return TEXT("Predicted");
+	case EGSCInputLatencyCategory::ServerConfirmed:
+		return TEXT("ServerConfirmed");
+	default:
+		return TEXT("Unknown");
+	}
+}
@@ -0,0 +1,199 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Core/Debug/GSCMemoryReport.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Components/GSCCoreComponent.h"
+#include "Engine/World.h"
+#include "GameFeatures/Actions/GSCGameFeatureAction_AddAbilities.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectIterator.h"
+
+namespace GSCMemoryReport_Impl
+{
+	static FAutoConsoleCommand ReportCommand(
+		TEXT("GASCompanion.Memory.Report"),
+		TEXT("Prints Ability System memory footprint (attribute sets, abilities, effects, GAS Companion bookkeeping, game features) per actor and per actor class. Optional argument: actor class name filter"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			FGSCMemoryReport::Dump(World, Ar, Args.Num() > 0 ? Args[0] : FString());
+		})
+	);
+
+	static SIZE_T CountObjectBytes(UObject* Object)
+	{
+		if (!Object)
+		{
+			return 0;
+		}
+
+		FArchiveCountMem CountMem(Object);
+		return CountMem.GetMax();
+	}
+
+	static FString FormatBytes(const SIZE_T Bytes)
+	{
+		return FString::Printf(TEXT("%.1f KB"), Bytes / 1024.f);
+	}
+
+	static void LogFootprint(FOutputDevice& Ar, const FString& Name, const FGSCMemoryFootprint& Footprint, const int32 Count = 1)
+	{
+		Ar.Logf(
+			TEXT("  %-48s %6d %12s %12s %12s %12s %12s %12s"),
+			*Name,
+			Count,
+			*FormatBytes(Footprint.AttributeSets),
+			*FormatBytes(Footprint.Abilities),
+			*FormatBytes(Footprint.Effects),
+			*FormatBytes(Footprint.Bookkeeping),
+			*FormatBytes(Footprint.GameFeatures),
+			*FormatBytes(Footprint.GetTotal())
+		);
+	}
+
+	static void LogHeader(FOutputDevice& Ar, const TCHAR* Title)
+	{
+		Ar.Logf(TEXT("%s"), Title);
+		Ar.Logf(TEXT("  %-48s %6s %12s %12s %12s %12s %12s %12s"), TEXT("Name"), TEXT("Count"), TEXT("Attributes"), TEXT("Abilities"), TEXT("Effects"), TEXT("Bookkeeping"), TEXT("GameFeatures"), TEXT("Total"));
+	}
+}
+
+FGSCMemoryFootprint& FGSCMemoryFootprint::operator+=(const FGSCMemoryFootprint& Other)
+{
+	AttributeSets += Other.AttributeSets;
+	Abilities += Other.Abilities;
+	Effects += Other.Effects;
+	Bookkeeping += Other.Bookkeeping;
+	GameFeatures += Other.GameFeatures;
+	return *this;
+}
+
+FGSCMemoryFootprint FGSCMemoryReport::GetFootprint(const UAbilitySystemComponent* AbilitySystemComponent)
+{
+	using namespace GSCMemoryReport_Impl;
+
+	FGSCMemoryFootprint Footprint;
+	if (!AbilitySystemComponent)
+	{
+		return Footprint;
+	}
+
+	for (UAttributeSet* AttributeSet : AbilitySystemComponent->GetSpawnedAttributes())
+	{
+		Footprint.AttributeSets += CountObjectBytes(AttributeSet);
+	}
+
+	const TArray<FGameplayAbilitySpec>& AbilitySpecs = AbilitySystemComponent->GetActivatableAbilities();
+	Footprint.Abilities += AbilitySpecs.GetAllocatedSize();
+	for (const FGameplayAbilitySpec& AbilitySpec : AbilitySpecs)
+	{
+		Footprint.Abilities += GetAllocatedSize(AbilitySpec);
+		for (UGameplayAbility* AbilityInstance : AbilitySpec.GetAbilityInstances())
+		{
+			Footprint.Abilities += CountObjectBytes(AbilityInstance);
+		}
+	}
+
+	Footprint.Effects += AbilitySystemComponent->GetNumActiveGameplayEffects() * sizeof(FActiveGameplayEffect);
+
+	if (const UGSCAbilitySystemComponent* CompanionASC = Cast<UGSCAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		Footprint.Bookkeeping += CompanionASC->GetAllocatedSize();
+	}
+
+	const AActor* AvatarActor = AbilitySystemComponent->GetAvatarActor_Direct();
+	if (const UGSCCoreComponent* CoreComponent = AvatarActor ? AvatarActor->FindComponentByClass<UGSCCoreComponent>() : nullptr)
+	{
+		Footprint.Bookkeeping += CoreComponent->GetAllocatedSize();
+	}
+
+	const AActor* OwnerActor = AbilitySystemComponent->GetOwnerActor();
+	for (TObjectIterator<UGSCGameFeatureAction_AddAbilities> It; It; ++It)
+	{
+		Footprint.GameFeatures += It->GetAllocatedSize(OwnerActor);
+	}
+
+	return Footprint;
+}
+
+SIZE_T FGSCMemoryReport::GetAllocatedSize(const FGameplayAbilitySpec& AbilitySpec)
+{
+	return AbilitySpec.DynamicAbilityTags.Num() * sizeof(FGameplayTag)
+		+ AbilitySpec.ReplicatedInstances.GetAllocatedSize()
+		+ AbilitySpec.NonReplicatedInstances.GetAllocatedSize();
+}
+
+void FGSCMemoryReport::Dump(const UWorld* World, FOutputDevice& Ar, const FString& ClassFilter)
+{
+	using namespace GSCMemoryReport_Impl;
+
+	struct FActorEntry
+	{
+		FString Name;
+		FGSCMemoryFootprint Footprint;
+	};
+
+	struct FClassEntry
+	{
+		int32 Count = 0;
+		FGSCMemoryFootprint Footprint;
+	};
+
+	TArray<FActorEntry> ActorEntries;
+	TMap<FString, FClassEntry> ClassEntries;
+	FGSCMemoryFootprint TotalFootprint;
+
+	for (TObjectIterator<UAbilitySystemComponent> It; It; ++It)
+	{
+		const UAbilitySystemComponent* AbilitySystemComponent = *It;
+		if (AbilitySystemComponent->IsTemplate() || (World && AbilitySystemComponent->GetWorld() != World))
+		{
+			continue;
+		}
+
+		const AActor* OwnerActor = AbilitySystemComponent->GetOwner();
+		const FString ClassName = OwnerActor ? OwnerActor->GetClass()->GetName() : TEXT("None");
+		if (!ClassFilter.IsEmpty() && !ClassName.Contains(ClassFilter))
+		{
+			continue;
+		}
+
+		const FGSCMemoryFootprint Footprint = GetFootprint(AbilitySystemComponent);
+		ActorEntries.Add({ GetNameSafe(OwnerActor), Footprint });
+
+		FClassEntry& ClassEntry = ClassEntries.FindOrAdd(ClassName);
+		ClassEntry.Count++;
+		ClassEntry.Footprint += Footprint;
+
+		TotalFootprint += Footprint;
+	}
+
+	ActorEntries.Sort([](const FActorEntry& A, const FActorEntry& B)
+	{
+		return A.Footprint.GetTotal() > B.Footprint.GetTotal();
+	});
+
+	ClassEntries.ValueSort([](const FClassEntry& A, const FClassEntry& B)
+	{
+		return A.Footprint.GetTotal() > B.Footprint.GetTotal();
+	});
+
+	Ar.Logf(TEXT("GAS Companion memory report for %s (%d actors)"), *GetNameSafe(World), ActorEntries.Num());
+
+	LogHeader(Ar, TEXT("Per actor:"));
+	for (const FActorEntry& ActorEntry : ActorEntries)
+	{
+		LogFootprint(Ar, ActorEntry.Name, ActorEntry.Footprint);
+	}
+
+	LogHeader(Ar, TEXT("Per actor class (sum, average per actor in parenthesis):"));
+	for (const TPair<FString, FClassEntry>& Pair : ClassEntries)
+	{
+		LogFootprint(Ar, FString::Printf(TEXT("%s (%s)"), *Pair.Key, *FormatBytes(Pair.Value.Footprint.GetTotal() / FMath::Max(Pair.Value.Count, 1))), Pair.Value.Footprint, Pair.Value.Count);
+	}
+
+	LogHeader(Ar, TEXT("Total:"));
+	LogFootprint(Ar, TEXT("All"), TotalFootprint, ActorEntries.Num());
+}
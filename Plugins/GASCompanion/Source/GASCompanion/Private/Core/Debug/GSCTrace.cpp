@@ -0,0 +1,72 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Core/Debug/GSCTrace.h"
+
+#include "GameFramework/Actor.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+const TCHAR* LexToString(const EGSCTraceEventType EventType)
+{
+	switch (EventType)
+	{
+	case EGSCTraceEventType::AbilityGranted: return TEXT("AbilityGranted");
+	case EGSCTraceEventType::AbilityActivated: return TEXT("AbilityActivated");
+	case EGSCTraceEventType::AbilityCommitted: return TEXT("AbilityCommitted");
+	case EGSCTraceEventType::AbilityEnded: return TEXT("AbilityEnded");
+	case EGSCTraceEventType::AbilityFailed: return TEXT("AbilityFailed");
+	case EGSCTraceEventType::EffectAdded: return TEXT("EffectAdded");
+	case EGSCTraceEventType::EffectStackChanged: return TEXT("EffectStackChanged");
+	case EGSCTraceEventType::EffectRemoved: return TEXT("EffectRemoved");
+	case EGSCTraceEventType::ComboIndexChanged: return TEXT("ComboIndexChanged");
+	case EGSCTraceEventType::AbilityQueueOpened: return TEXT("AbilityQueueOpened");
+	case EGSCTraceEventType::AbilityQueueClosed: return TEXT("AbilityQueueClosed");
+	case EGSCTraceEventType::AbilityQueueConsumed: return TEXT("AbilityQueueConsumed");
+	case EGSCTraceEventType::GameFeatureAbilitiesGranted: return TEXT("GameFeatureAbilitiesGranted");
+	default: return TEXT("Unknown");
+	}
+}
+
+#if GSC_WITH_TRACE
+
+UE_TRACE_CHANNEL_DEFINE(GASCompanionChannel)
+
+UE_TRACE_EVENT_BEGIN(GASCompanion, Event)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ActorId)
+	UE_TRACE_EVENT_FIELD(int32, PredictionKey)
+	UE_TRACE_EVENT_FIELD(int32, Value)
+	UE_TRACE_EVENT_FIELD(uint8, EventType)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, EventName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ActorName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassName)
+UE_TRACE_EVENT_END()
+
+void FGSCTrace::OutputEvent(const EGSCTraceEventType EventType, const AActor* Actor, const UObject* Subject, const FPredictionKey& PredictionKey, const int32 Value)
+{
+	const TCHAR* EventName = LexToString(EventType);
+	const FString ActorName = GetNameSafe(Actor);
+
+	FString ClassName;
+	if (const UClass* SubjectClass = Cast<UClass>(Subject))
+	{
+		ClassName = SubjectClass->GetName();
+	}
+	else if (Subject)
+	{
+		ClassName = Subject->GetClass()->GetName();
+	}
+
+	UE_TRACE_LOG(GASCompanion, Event, GASCompanionChannel)
+		<< Event.Cycle(FPlatformTime::Cycles64())
+		<< Event.ActorId(Actor ? Actor->GetUniqueID() : 0)
+		<< Event.PredictionKey(PredictionKey.Current)
+		<< Event.Value(Value)
+		<< Event.EventType(static_cast<uint8>(EventType))
+		<< Event.EventName(EventName)
+		<< Event.ActorName(*ActorName, ActorName.Len())
+		<< Event.ClassName(*ClassName, ClassName.Len());
+
+	TRACE_BOOKMARK(TEXT("GSC %s %s (%s) [%d]"), EventName, *ClassName, *ActorName, Value);
+}
+
+#endif
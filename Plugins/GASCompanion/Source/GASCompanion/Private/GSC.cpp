@@ -4,6 +4,8 @@
 
 #include "AbilitySystemGlobals.h"
 #include "GSCAssetManager.h"
+#include "Abilities/GSCTargetDataTypes.h"
+#include "Engine/World.h"
 #include "Core/Settings/GSCDeveloperSettings.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
@@ -22,6 +24,7 @@ void FGSCModule::StartupModule()
 
 	// Register post engine delegate to handle init Ability System Global data initialization
 	FCoreDelegates::OnPostEngineInit.AddRaw(this, &FGSCModule::OnPostEngineInit);
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FGSCModule::OnWorldCleanup);
 
 #if WITH_EDITOR
 	// Register custom project settings
@@ -60,6 +63,7 @@ void FGSCModule::ShutdownModule()
 
 	// Remove delegates
 	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
 
 #if WITH_EDITOR
 	// unregister settings
@@ -210,6 +214,11 @@ void FGSCModule::OnPostEngineInit()
 	}
 }
 
+void FGSCModule::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	FGSCTargetDataPool::Get().Trim();
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FGSCModule, GASCompanion)
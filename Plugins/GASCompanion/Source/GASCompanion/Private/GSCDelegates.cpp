@@ -4,3 +4,5 @@
 
 FGSCDelegates::FGSCDebugWidgetAnimMontage FGSCDelegates::OnAddAbilityQueueFromMontageRow;
 FGSCDelegates::FGSCDebugWidgetUpdateAllowedAbilities FGSCDelegates::OnUpdateAllowedAbilities;
+FGSCDelegates::FGSCDebugWidgetAbilityQueueState FGSCDelegates::OnAbilityQueueStateChanged;
+FGSCDelegates::FGSCOnAbilityActorInfoInitialized FGSCDelegates::OnAbilityActorInfoInitialized;
@@ -0,0 +1,27 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "GSCStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(GASCOMPANION_API, GASCompanion, false);
+
+DEFINE_STAT(STAT_GSC_AbilityLocalInputPressed);
+DEFINE_STAT(STAT_GSC_GrantDefaultAbilitiesAndAttributes);
+DEFINE_STAT(STAT_GSC_RestoreSnapshot);
+DEFINE_STAT(STAT_GSC_PostGameplayEffectExecute);
+DEFINE_STAT(STAT_GSC_CoreComponentBroadcast);
+DEFINE_STAT(STAT_GSC_GameFeatureAddActorAbilities);
+DEFINE_STAT(STAT_GSC_GameFeatureRemoveActorAbilities);
+
+DEFINE_STAT(STAT_GSC_NumAbilityActivations);
+DEFINE_STAT(STAT_GSC_NumAbilityFailures);
+DEFINE_STAT(STAT_GSC_NumAbilityEnds);
+DEFINE_STAT(STAT_GSC_NumEffectExecutions);
+DEFINE_STAT(STAT_GSC_NumDelegateBroadcasts);
+DEFINE_STAT(STAT_GSC_NumGameFeatureAbilitiesGranted);
+DEFINE_STAT(STAT_GSC_NumForcedNetUpdates);
+
+LLM_DEFINE_TAG(GASCompanion);
+LLM_DEFINE_TAG(GASCompanion_Abilities);
+LLM_DEFINE_TAG(GASCompanion_Attributes);
+LLM_DEFINE_TAG(GASCompanion_GameFeatures);
+LLM_DEFINE_TAG(GASCompanion_UI);
@@ -10,10 +10,12 @@
 #include "Abilities/GSCAbilitySystemComponent.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "Components/GSCCoreComponent.h"
+#include "Core/Debug/GSCTrace.h"
 #include "Engine/AssetManager.h"
 #include "Engine/World.h" // for FWorldDelegates::OnStartGameInstance
 #include "Engine/Engine.h" // for FWorldContext
 #include "GSCLog.h"
+#include "GSCStats.h"
 
 #define LOCTEXT_NAMESPACE "GASCompanion"
 
@@ -180,6 +182,9 @@ void UGSCGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor, con
 
 void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_GameFeatureAddActorAbilities);
+	LLM_SCOPE_BYTAG(GASCompanion_GameFeatures);
+
 	if (!IsValid(Actor))
 	{
 		GSC_LOG(Error, TEXT("Failed to find/add an ability component. Target Actor is not valid"));
@@ -300,11 +305,15 @@ void UGSCGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const
 		CoreComponent->RegisterAbilitySystemDelegates(AbilitySystemComponent);
 	}
 
+	GSC_TRACE_EVENT(GameFeatureAbilitiesGranted, AvatarActor ? AvatarActor : OwnerActor, this, FPredictionKey(), AddedExtensions.Abilities.Num())
+
 	ActiveExtensions.Add(OwnerActor, AddedExtensions);
 }
 
 void UGSCGameFeatureAction_AddAbilities::RemoveActorAbilities(const AActor* Actor)
 {
+	GSC_SCOPE_CYCLE_COUNTER(STAT_GSC_GameFeatureRemoveActorAbilities);
+
 	if (!Actor)
 	{
 		return;
@@ -403,6 +412,21 @@ UActorComponent* UGSCGameFeatureAction_AddAbilities::FindOrAddComponentForActor(
 	return Component;
 }
 
+SIZE_T UGSCGameFeatureAction_AddAbilities::GetAllocatedSize(const AActor* Actor) const
+{
+	const FActorExtensions* ActorExtensions = ActiveExtensions.Find(const_cast<AActor*>(Actor));
+	if (!ActorExtensions)
+	{
+		return 0;
+	}
+
+	return sizeof(FActorExtensions)
+		+ ActorExtensions->Abilities.GetAllocatedSize()
+		+ ActorExtensions->Attributes.GetAllocatedSize()
+		+ ActorExtensions->InputBindingDelegateHandles.GetAllocatedSize()
+		+ ActorExtensions->EffectHandles.GetAllocatedSize();
+}
+
 void UGSCGameFeatureAction_AddAbilities::AddToWorld(const FWorldContext& WorldContext)
 {
 	const UWorld* World = WorldContext.World();
@@ -451,7 +475,8 @@ void UGSCGameFeatureAction_AddAbilities::TryGrantAbility(UGSCAbilitySystemCompon
 	check(AbilityType);
 	check(AbilitySystemComponent);
 
-	AbilitySpec = FGameplayAbilitySpec(AbilityType);
+	// Game Feature action as source object, so that abilities granted here can be told apart (eg. excluded from ASC snapshots)
+	AbilitySpec = FGameplayAbilitySpec(AbilityType, 1, INDEX_NONE, this);
 	
 	// Try to grant the ability first
 	if (AbilitySystemComponent->IsOwnerActorAuthoritative())
@@ -461,6 +486,7 @@ void UGSCGameFeatureAction_AddAbilities::TryGrantAbility(UGSCAbilitySystemCompon
 		{
 			GSC_LOG(Verbose, TEXT("AddActorAbilities: Authority, Grant Ability (%s) with input ID: %d"), *AbilityType->GetName())
 			AbilityHandle = AbilitySystemComponent->GiveAbility(AbilitySpec);
+			GSC_INC_COUNTER(STAT_GSC_NumGameFeatureAbilitiesGranted);
 		}
 		else
 		{
@@ -485,7 +511,7 @@ void UGSCGameFeatureAction_AddAbilities::TryGrantAbility(UGSCAbilitySystemCompon
 	}
 }
 
-void UGSCGameFeatureAction_AddAbilities::TryBindAbilityInput(UGSCAbilitySystemComponent* AbilitySystemComponent, const FGSCGameFeatureAbilityMapping& AbilityMapping, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry, FGameplayAbilitySpecHandle AbilityHandle, FGameplayAbilitySpec AbilitySpec, FActorExtensions& AddedExtensions)
+void UGSCGameFeatureAction_AddAbilities::TryBindAbilityInput(UGSCAbilitySystemComponent* AbilitySystemComponent, const FGSCGameFeatureAbilityMapping& AbilityMapping, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry, FGameplayAbilitySpecHandle AbilityHandle, const FGameplayAbilitySpec& AbilitySpec, FActorExtensions& AddedExtensions)
 {
 	check(AbilitySystemComponent);
 
@@ -517,7 +543,8 @@ void UGSCGameFeatureAction_AddAbilities::TryBindAbilityInput(UGSCAbilitySystemCo
 			{
 				// Register a delegate triggered when ability is granted and available on clients (needed when Game Features are made active during play)
 				UInputAction* InputAction = AbilityMapping.InputAction.LoadSynchronous();
-				const FDelegateHandle DelegateHandle = AbilitySystemComponent->OnGiveAbilityDelegate.AddUObject(this, &UGSCGameFeatureAction_AddAbilities::HandleOnGiveAbility, InputComponent, InputAction, AbilityMapping.TriggerEvent, AbilitySpec);
+				const TSubclassOf<UGameplayAbility> AbilityClass = AbilitySpec.Ability ? AbilitySpec.Ability->GetClass() : nullptr;
+				const FDelegateHandle DelegateHandle = AbilitySystemComponent->OnGiveAbilityDelegate.AddUObject(this, &UGSCGameFeatureAction_AddAbilities::HandleOnGiveAbility, InputComponent, InputAction, AbilityMapping.TriggerEvent, AbilityClass);
 				AddedExtensions.InputBindingDelegateHandles.Add(DelegateHandle);
 			}
 		}
@@ -587,7 +614,9 @@ void UGSCGameFeatureAction_AddAbilities::TryGrantGameplayEffect(UAbilitySystemCo
 		return;
 	}
 
-	const FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
+	FGameplayEffectContextHandle EffectContext = AbilitySystemComponent->MakeEffectContext();
+	EffectContext.AddSourceObject(this);
+
 	const FGameplayEffectSpecHandle NewHandle = AbilitySystemComponent->MakeOutgoingSpec(EffectType, Level, EffectContext);
 	if (NewHandle.IsValid())
 	{
@@ -601,7 +630,7 @@ void UGSCGameFeatureAction_AddAbilities::TryGrantGameplayEffect(UAbilitySystemCo
 
 // ReSharper disable once CppMemberFunctionMayBeConst
 // ReSharper disable once CppParameterMayBeConstPtrOrRef
-void UGSCGameFeatureAction_AddAbilities::HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, const EGSCAbilityTriggerEvent TriggerEvent, const FGameplayAbilitySpec NewAbilitySpec)
+void UGSCGameFeatureAction_AddAbilities::HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, const EGSCAbilityTriggerEvent TriggerEvent, const TSubclassOf<UGameplayAbility> AbilityClass)
 {
 	GSC_LOG(
 		Verbose,
@@ -613,7 +642,7 @@ void UGSCGameFeatureAction_AddAbilities::HandleOnGiveAbility(FGameplayAbilitySpe
 		*GetNameSafe(InputComponent)
 	);
 
-	if (InputComponent && InputAction && AbilitySpec.Ability == NewAbilitySpec.Ability)
+	if (InputComponent && InputAction && AbilitySpec.Ability && AbilitySpec.Ability->GetClass() == AbilityClass)
 	{
 		InputComponent->SetInputBinding(InputAction, TriggerEvent, AbilitySpec.Handle);
 	}
@@ -22,6 +22,14 @@ UAbilitySystemComponent* AGSCModularCharacter::GetAbilitySystemComponent() const
 void AGSCModularCharacter::PreInitializeComponents()
 {
 	Super::PreInitializeComponents();
+
+	// Profile must be known before ASC InitializeComponent (InitAbilityActorInfo). Character value only overrides the ASC one
+	// when not left to default, SetProfile is still called to apply the ASC profile replication mode.
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->SetProfile(AbilitySystemProfile != EGSCAbilitySystemProfile::Full ? AbilitySystemProfile : AbilitySystemComponent->Profile);
+	}
+
 	UGameFrameworkComponentManager::AddGameFrameworkComponentReceiver(this);
 }
 
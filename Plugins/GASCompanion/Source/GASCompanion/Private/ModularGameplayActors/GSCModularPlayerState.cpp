@@ -5,7 +5,66 @@
 #include "Abilities/GSCAbilitySystemComponent.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "Components/PlayerStateComponent.h"
+#include "Engine/World.h"
+#include "GSCDelegates.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+namespace GSCModularPlayerState_Impl
+{
+	static int32 bAdaptiveNetUpdateFrequency = 0;
+	static FAutoConsoleVariableRef CVarAdaptiveNetUpdateFrequency(
+		TEXT("GASCompanion.PlayerState.AdaptiveNetUpdate"),
+		bAdaptiveNetUpdateFrequency,
+		TEXT("Drive AGSCModularPlayerState NetUpdateFrequency from Ability System activity, for Player States with bAdaptiveNetUpdateFrequency (0 = fixed NetUpdateFrequency, 1 = adaptive). Applies to Player States beginning play afterwards"),
+		ECVF_Default
+	);
+
+	/**
+	 * Replication checks scheduled by NetUpdateFrequency over time (frequency * seconds), for all adaptive Player States,
+	 * compared to what the fixed NetUpdateFrequency would have scheduled. Each check costs server CPU (property comparison)
+	 * and, when something changed, bandwidth.
+	 */
+	struct FNetUpdateStats
+	{
+		double Seconds = 0.0;
+		double ActiveSeconds = 0.0;
+		double NumAdaptiveNetUpdates = 0.0;
+		double NumFixedNetUpdates = 0.0;
+		int64 NumForcedNetUpdates = 0;
+	};
+
+	static FNetUpdateStats NetUpdateStats;
+
+	static FAutoConsoleCommand NetUpdateStatsCommand(
+		TEXT("GASCompanion.PlayerState.NetUpdateStats"),
+		TEXT("Prints the number of replication checks scheduled by adaptive Player State NetUpdateFrequency, against the fixed NetUpdateFrequency. Compare bandwidth with `stat net` and GASCompanion.PlayerState.AdaptiveNetUpdate 0 / 1"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			const double Ratio = NetUpdateStats.NumFixedNetUpdates > 0.0 ? NetUpdateStats.NumAdaptiveNetUpdates / NetUpdateStats.NumFixedNetUpdates : 1.0;
+			Ar.Logf(
+				TEXT("GAS Companion Player State net updates: %.0f scheduled (%.0f with fixed frequency, %+.1f%%), %lld forced, active %.1f%% of %.1f seconds"),
+				NetUpdateStats.NumAdaptiveNetUpdates,
+				NetUpdateStats.NumFixedNetUpdates,
+				(Ratio - 1.0) * 100.0,
+				NetUpdateStats.NumForcedNetUpdates,
+				NetUpdateStats.Seconds > 0.0 ? NetUpdateStats.ActiveSeconds / NetUpdateStats.Seconds * 100.0 : 0.0,
+				NetUpdateStats.Seconds
+			);
+		})
+	);
+
+	static FAutoConsoleCommand NetUpdateStatsResetCommand(
+		TEXT("GASCompanion.PlayerState.ResetNetUpdateStats"),
+		TEXT("Resets the adaptive Player State NetUpdateFrequency stats"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			NetUpdateStats = FNetUpdateStats();
+		})
+	);
+}
 
 AGSCModularPlayerState::AGSCModularPlayerState(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -27,6 +86,9 @@ AGSCModularPlayerState::AGSCModularPlayerState(const FObjectInitializer& ObjectI
 	//
 	// Default is very low for PlayerStates and introduces perceived lag in the ability system.
 	// 100 is probably way too high for a shipping game, you can adjust to fit your needs.
+	//
+	// This is the fixed frequency, used when bAdaptiveNetUpdateFrequency is disabled. Otherwise, NetUpdateFrequency
+	// moves between IdleNetUpdateFrequency and ActiveNetUpdateFrequency depending on Ability System activity.
 	NetUpdateFrequency = 10.0f;
 }
 
@@ -41,10 +103,16 @@ void AGSCModularPlayerState::BeginPlay()
 {
 	UGameFrameworkComponentManager::SendGameFrameworkComponentExtensionEvent(this, UGameFrameworkComponentManager::NAME_GameActorReady);
 	Super::BeginPlay();
+
+	if (bAdaptiveNetUpdateFrequency && GSCModularPlayerState_Impl::bAdaptiveNetUpdateFrequency && HasAuthority() && GetNetMode() != NM_Standalone)
+	{
+		StartAdaptiveNetUpdateFrequency();
+	}
 }
 
 void AGSCModularPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	StopAdaptiveNetUpdateFrequency();
 	UGameFrameworkComponentManager::RemoveGameFrameworkComponentReceiver(this);
 	Super::EndPlay(EndPlayReason);
 }
@@ -78,7 +146,9 @@ UAbilitySystemComponent* AGSCModularPlayerState::GetAbilitySystemComponent() con
 
 void AGSCModularPlayerState::CopyProperties(APlayerState* PlayerState)
 {
-	Super::Reset();
+	Super::CopyProperties(PlayerState);
+
+	TransferAbilitySystemState(this, Cast<AGSCModularPlayerState>(PlayerState));
 
 	TArray<UPlayerStateComponent*> ModularComponents;
 	GetComponents(ModularComponents);
@@ -86,11 +156,233 @@ void AGSCModularPlayerState::CopyProperties(APlayerState* PlayerState)
 	TArray<UPlayerStateComponent*> OtherModularComponents;
 	PlayerState->GetComponents(OtherModularComponents);
 
+	// Copy each component into the matching component (by class) of the new Player State
 	for (UPlayerStateComponent* Component : ModularComponents)
 	{
-		for (UPlayerStateComponent* OtherComponent : OtherModularComponents)
+		const int32 OtherIndex = OtherModularComponents.IndexOfByPredicate([Component](const UPlayerStateComponent* OtherComponent)
+		{
+			return OtherComponent->GetClass() == Component->GetClass();
+		});
+
+		if (OtherIndex != INDEX_NONE)
 		{
-			Component->CopyProperties(OtherComponent);
+			Component->CopyProperties(OtherModularComponents[OtherIndex]);
+			OtherModularComponents.RemoveAtSwap(OtherIndex, 1, false);
 		}
 	}
 }
+
+void AGSCModularPlayerState::OverrideWith(APlayerState* PlayerState)
+{
+	Super::OverrideWith(PlayerState);
+
+	// Reconnect, PlayerState is the inactive Player State kept around since disconnection
+	TransferAbilitySystemState(Cast<AGSCModularPlayerState>(PlayerState), this);
+}
+
+void AGSCModularPlayerState::TransferAbilitySystemState(const AGSCModularPlayerState* Source, AGSCModularPlayerState* Target)
+{
+	if (!Source || !Target || !Source->bTransferAbilitySystemState || !Target->bTransferAbilitySystemState)
+	{
+		return;
+	}
+
+	if (!Source->AbilitySystemComponent || !Target->AbilitySystemComponent)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FGSCAbilitySystemSnapshot Snapshot;
+	Source->AbilitySystemComponent->CaptureSnapshot(Snapshot);
+	Target->AbilitySystemComponent->RestoreSnapshot(Snapshot);
+
+	GSC_LOG(
+		Log,
+		TEXT("AGSCModularPlayerState::TransferAbilitySystemState from %s to %s in %.3f ms (%d abilities, %d attributes, %d effects)"),
+		*Source->GetName(),
+		*Target->GetName(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0,
+		Snapshot.Abilities.Num(),
+		Snapshot.Attributes.Num(),
+		Snapshot.Effects.Num()
+	)
+}
+
+void AGSCModularPlayerState::NotifyAbilitySystemActivity()
+{
+	if (!bAdaptiveNetUpdateRunning)
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	LastActivityTime = World->GetTimeSeconds();
+
+	if (bAbilitySystemActive)
+	{
+		// Already active, decay timer checks LastActivityTime when it fires
+		return;
+	}
+
+	SetAdaptiveNetUpdateFrequency(ActiveNetUpdateFrequency);
+	bAbilitySystemActive = true;
+
+	if (bForceNetUpdateOnActivity)
+	{
+		ForceNetUpdate();
+		GSCModularPlayerState_Impl::NetUpdateStats.NumForcedNetUpdates++;
+		GSC_INC_COUNTER(STAT_GSC_NumForcedNetUpdates);
+	}
+
+	World->GetTimerManager().SetTimer(NetUpdateDecayTimerHandle, this, &AGSCModularPlayerState::HandleNetUpdateDecay, FMath::Max(ActivityDecayDelay, KINDA_SMALL_NUMBER), false);
+}
+
+void AGSCModularPlayerState::StartAdaptiveNetUpdateFrequency()
+{
+	check(AbilitySystemComponent);
+
+	GSC_LOG(Verbose, TEXT("AGSCModularPlayerState::StartAdaptiveNetUpdateFrequency for %s - Idle: %.1f, Active: %.1f (fixed: %.1f)"), *GetName(), IdleNetUpdateFrequency, ActiveNetUpdateFrequency, NetUpdateFrequency)
+
+	FixedNetUpdateFrequency = NetUpdateFrequency;
+	bAdaptiveNetUpdateRunning = true;
+	bAbilitySystemActive = false;
+	LastNetUpdateFrequencyChangeTime = GetWorld()->GetTimeSeconds();
+	NetUpdateFrequency = IdleNetUpdateFrequency;
+
+	AbilityActivatedDelegateHandle = AbilitySystemComponent->AbilityActivatedCallbacks.AddUObject(this, &AGSCModularPlayerState::HandleAbilityActivated);
+	AbilityEndedDelegateHandle = AbilitySystemComponent->AbilityEndedCallbacks.AddUObject(this, &AGSCModularPlayerState::HandleAbilityEnded);
+	EffectAppliedDelegateHandle = AbilitySystemComponent->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &AGSCModularPlayerState::HandleGameplayEffectApplied);
+	EffectRemovedDelegateHandle = AbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &AGSCModularPlayerState::HandleGameplayEffectRemoved);
+	GameplayTagChangedDelegateHandle = AbilitySystemComponent->RegisterGenericGameplayTagEvent().AddUObject(this, &AGSCModularPlayerState::HandleGameplayTagChanged);
+
+	// Attribute sets may be granted later on, by pawn InitAbilityActorInfo or Game Features
+	RegisterAttributeActivityDelegates();
+	FGSCDelegates::OnAbilityActorInfoInitialized.AddUObject(this, &AGSCModularPlayerState::HandleAbilityActorInfoInitialized);
+}
+
+void AGSCModularPlayerState::StopAdaptiveNetUpdateFrequency()
+{
+	if (!bAdaptiveNetUpdateRunning)
+	{
+		return;
+	}
+
+	// Account for the last segment
+	SetAdaptiveNetUpdateFrequency(FixedNetUpdateFrequency);
+	bAdaptiveNetUpdateRunning = false;
+	bAbilitySystemActive = false;
+
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(NetUpdateDecayTimerHandle);
+	}
+
+	FGSCDelegates::OnAbilityActorInfoInitialized.RemoveAll(this);
+
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->AbilityActivatedCallbacks.Remove(AbilityActivatedDelegateHandle);
+		AbilitySystemComponent->AbilityEndedCallbacks.Remove(AbilityEndedDelegateHandle);
+		AbilitySystemComponent->OnGameplayEffectAppliedDelegateToSelf.Remove(EffectAppliedDelegateHandle);
+		AbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().Remove(EffectRemovedDelegateHandle);
+		AbilitySystemComponent->RegisterGenericGameplayTagEvent().Remove(GameplayTagChangedDelegateHandle);
+
+		TArray<FGameplayAttribute> Attributes;
+		AbilitySystemComponent->GetAllAttributes(Attributes);
+		for (const FGameplayAttribute& Attribute : Attributes)
+		{
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+		}
+	}
+
+	AbilityActivatedDelegateHandle.Reset();
+	AbilityEndedDelegateHandle.Reset();
+	EffectAppliedDelegateHandle.Reset();
+	EffectRemovedDelegateHandle.Reset();
+	GameplayTagChangedDelegateHandle.Reset();
+}
+
+void AGSCModularPlayerState::RegisterAttributeActivityDelegates()
+{
+	check(AbilitySystemComponent);
+
+	TArray<FGameplayAttribute> Attributes;
+	AbilitySystemComponent->GetAllAttributes(Attributes);
+	for (const FGameplayAttribute& Attribute : Attributes)
+	{
+		FOnGameplayAttributeValueChange& Delegate = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute);
+		Delegate.RemoveAll(this);
+		Delegate.AddUObject(this, &AGSCModularPlayerState::HandleAttributeChanged);
+	}
+}
+
+void AGSCModularPlayerState::SetAdaptiveNetUpdateFrequency(const float NewFrequency)
+{
+	using namespace GSCModularPlayerState_Impl;
+
+	// Accumulate stats for the segment ending now, with the previous frequency
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : LastNetUpdateFrequencyChangeTime;
+	const double Elapsed = FMath::Max(Now - LastNetUpdateFrequencyChangeTime, 0.0);
+
+	NetUpdateStats.Seconds += Elapsed;
+	NetUpdateStats.ActiveSeconds += bAbilitySystemActive ? Elapsed : 0.0;
+	NetUpdateStats.NumAdaptiveNetUpdates += Elapsed * NetUpdateFrequency;
+	NetUpdateStats.NumFixedNetUpdates += Elapsed * FixedNetUpdateFrequency;
+
+	LastNetUpdateFrequencyChangeTime = Now;
+	NetUpdateFrequency = NewFrequency;
+}
+
+void AGSCModularPlayerState::HandleNetUpdateDecay()
+{
+	const float TimeSinceActivity = GetWorld()->GetTimeSeconds() - LastActivityTime;
+	if (TimeSinceActivity < ActivityDecayDelay)
+	{
+		// Activity happened since the timer was set, wait for the remaining time
+		GetWorld()->GetTimerManager().SetTimer(NetUpdateDecayTimerHandle, this, &AGSCModularPlayerState::HandleNetUpdateDecay, ActivityDecayDelay - TimeSinceActivity, false);
+		return;
+	}
+
+	SetAdaptiveNetUpdateFrequency(IdleNetUpdateFrequency);
+	bAbilitySystemActive = false;
+}
+
+void AGSCModularPlayerState::HandleAbilityActorInfoInitialized(UAbilitySystemComponent* InAbilitySystemComponent)
+{
+	if (InAbilitySystemComponent == AbilitySystemComponent)
+	{
+		RegisterAttributeActivityDelegates();
+	}
+}
+
+void AGSCModularPlayerState::HandleAbilityActivated(UGameplayAbility* Ability)
+{
+	NotifyAbilitySystemActivity();
+}
+
+void AGSCModularPlayerState::HandleAbilityEnded(UGameplayAbility* Ability)
+{
+	NotifyAbilitySystemActivity();
+}
+
+void AGSCModularPlayerState::HandleGameplayEffectApplied(UAbilitySystemComponent* Source, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	NotifyAbilitySystemActivity();
+}
+
+void AGSCModularPlayerState::HandleGameplayEffectRemoved(const FActiveGameplayEffect& GameplayEffect)
+{
+	NotifyAbilitySystemActivity();
+}
+
+void AGSCModularPlayerState::HandleGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount)
+{
+	NotifyAbilitySystemActivity();
+}
+
+void AGSCModularPlayerState::HandleAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	NotifyAbilitySystemActivity();
+}
@@ -0,0 +1,81 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Subsystems/GSCInputIDSubsystem.h"
+
+#include "Engine/World.h"
+#include "GSCLog.h"
+
+void UGSCInputIDSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FScopeLock Lock(&InputIDsCriticalSection);
+	UsedInputIDs.Init(false, 32);
+	UsedInputIDs[InvalidInputID] = true;
+	NumUsedInputIDs = 0;
+}
+
+void UGSCInputIDSubsystem::Deinitialize()
+{
+	{
+		FScopeLock Lock(&InputIDsCriticalSection);
+		GSC_LOG(Verbose, TEXT("UGSCInputIDSubsystem::Deinitialize - %d Input IDs still in use (Capacity: %d)"), NumUsedInputIDs, UsedInputIDs.Num())
+		UsedInputIDs.Empty();
+		NumUsedInputIDs = 0;
+	}
+
+	Super::Deinitialize();
+}
+
+int32 UGSCInputIDSubsystem::AcquireInputID()
+{
+	FScopeLock Lock(&InputIDsCriticalSection);
+
+	int32 InputID = UsedInputIDs.FindAndSetFirstZeroBit();
+	if (InputID == INDEX_NONE)
+	{
+		InputID = UsedInputIDs.Add(true);
+	}
+
+	check(InputID != InvalidInputID);
+	NumUsedInputIDs++;
+	return InputID;
+}
+
+void UGSCInputIDSubsystem::ReleaseInputID(const int32 InputID)
+{
+	if (InputID == InvalidInputID)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&InputIDsCriticalSection);
+
+	if (!UsedInputIDs.IsValidIndex(InputID) || !UsedInputIDs[InputID])
+	{
+		GSC_LOG(Warning, TEXT("UGSCInputIDSubsystem::ReleaseInputID - Trying to release Input ID %d which is not in use"), InputID)
+		return;
+	}
+
+	UsedInputIDs[InputID] = false;
+	NumUsedInputIDs--;
+}
+
+int32 UGSCInputIDSubsystem::GetNumUsedInputIDs() const
+{
+	FScopeLock Lock(&InputIDsCriticalSection);
+	return NumUsedInputIDs;
+}
+
+int32 UGSCInputIDSubsystem::GetInputIDCapacity() const
+{
+	FScopeLock Lock(&InputIDsCriticalSection);
+	const int32 LastUsed = UsedInputIDs.FindLast(true);
+	return LastUsed == INDEX_NONE ? 0 : LastUsed + 1;
+}
+
+UGSCInputIDSubsystem* UGSCInputIDSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGSCInputIDSubsystem>() : nullptr;
+}
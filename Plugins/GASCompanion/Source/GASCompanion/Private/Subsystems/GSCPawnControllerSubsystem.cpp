@@ -0,0 +1,75 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Subsystems/GSCPawnControllerSubsystem.h"
+
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GSCLog.h"
+
+void UGSCPawnControllerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	GetGameInstance()->GetOnPawnControllerChanged().AddDynamic(this, &UGSCPawnControllerSubsystem::HandlePawnControllerChanged);
+}
+
+void UGSCPawnControllerSubsystem::Deinitialize()
+{
+	GSC_LOG(Verbose, TEXT("UGSCPawnControllerSubsystem::Deinitialize - %d pawns still registered"), AbilitySystemComponents.Num())
+
+	GetGameInstance()->GetOnPawnControllerChanged().RemoveAll(this);
+	AbilitySystemComponents.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGSCPawnControllerSubsystem::RegisterAbilitySystem(APawn* Pawn, UGSCAbilitySystemComponent* AbilitySystemComponent)
+{
+	if (!Pawn || !AbilitySystemComponent)
+	{
+		return;
+	}
+
+	AbilitySystemComponents.Add(Pawn, AbilitySystemComponent);
+}
+
+void UGSCPawnControllerSubsystem::UnregisterAbilitySystem(const APawn* Pawn, const UGSCAbilitySystemComponent* AbilitySystemComponent)
+{
+	const TObjectKey<APawn> PawnKey(Pawn);
+	const TWeakObjectPtr<UGSCAbilitySystemComponent>* RegisteredAbilitySystemComponent = AbilitySystemComponents.Find(PawnKey);
+
+	// Only remove if not registered again since, for another component
+	if (RegisteredAbilitySystemComponent && (!RegisteredAbilitySystemComponent->IsValid() || RegisteredAbilitySystemComponent->Get() == AbilitySystemComponent))
+	{
+		AbilitySystemComponents.Remove(PawnKey);
+	}
+}
+
+UGSCPawnControllerSubsystem* UGSCPawnControllerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UGSCPawnControllerSubsystem>() : nullptr;
+}
+
+// ReSharper disable CppParameterMayBeConstPtrOrRef
+void UGSCPawnControllerSubsystem::HandlePawnControllerChanged(APawn* Pawn, AController* NewController)
+{
+	const TObjectKey<APawn> PawnKey(Pawn);
+	const TWeakObjectPtr<UGSCAbilitySystemComponent>* AbilitySystemComponent = AbilitySystemComponents.Find(PawnKey);
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	if (UGSCAbilitySystemComponent* ResolvedAbilitySystemComponent = AbilitySystemComponent->Get())
+	{
+		ResolvedAbilitySystemComponent->OnPawnControllerChanged(Pawn, NewController);
+	}
+	else
+	{
+		// Component was destroyed without unregistering (eg. garbage collected along with its owner)
+		AbilitySystemComponents.Remove(PawnKey);
+	}
+}
@@ -0,0 +1,251 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Subsystems/GSCWidgetUpdateSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "UI/GSCUserWidget.h"
+#include "GSCLog.h"
+#include "GSCStats.h"
+
+namespace GSCWidgetUpdateSubsystem_Impl
+{
+	/** Interval (in seconds) at which registered widgets are checked for garbage collected ones, when no widget is dirty */
+	static constexpr double PruneInterval = 1.0;
+}
+
+void UGSCWidgetUpdateSubsystem::Deinitialize()
+{
+	GSC_LOG(Verbose, TEXT("UGSCWidgetUpdateSubsystem::Deinitialize - %d widgets still registered (%d ASCs)"), Widgets.Num(), Subscriptions.Num())
+
+	for (TPair<TObjectKey<UAbilitySystemComponent>, FAbilitySystemSubscription>& Pair : Subscriptions)
+	{
+		Unsubscribe(Pair.Value);
+	}
+
+	Subscriptions.Empty();
+	Widgets.Empty();
+	NumDirtyWidgets = 0;
+
+	Super::Deinitialize();
+}
+
+void UGSCWidgetUpdateSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+
+	// Widgets unregister themselves on NativeDestruct, this only catches the ones garbage collected without being destructed
+	const bool bShouldPrune = Now >= NextPruneTime;
+	if (NumDirtyWidgets == 0 && !bShouldPrune)
+	{
+		return;
+	}
+
+	if (bShouldPrune)
+	{
+		NextPruneTime = Now + GSCWidgetUpdateSubsystem_Impl::PruneInterval;
+	}
+
+	FVector ViewLocation = FVector::ZeroVector;
+	bool bHasViewLocation = false;
+	if (const APlayerController* PlayerController = World->GetFirstPlayerController())
+	{
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		bHasViewLocation = true;
+	}
+
+	TArray<TObjectKey<UGSCUserWidget>> DeadWidgets;
+	TArray<TPair<TWeakObjectPtr<UGSCUserWidget>, TArray<FPendingAttributeChange>>> DueUpdates;
+
+	for (TPair<TObjectKey<UGSCUserWidget>, FWidgetEntry>& Pair : Widgets)
+	{
+		FWidgetEntry& Entry = Pair.Value;
+		const UGSCUserWidget* Widget = Entry.Widget.Get();
+		if (!Widget)
+		{
+			DeadWidgets.Add(Pair.Key);
+			continue;
+		}
+
+		if (Entry.PendingChanges.Num() == 0 || Entry.NextUpdateTime > Now)
+		{
+			continue;
+		}
+
+		DueUpdates.Emplace(Entry.Widget, MoveTemp(Entry.PendingChanges));
+		Entry.PendingChanges.Reset();
+		Entry.NextUpdateTime = Now + GetUpdateInterval(*Widget, ViewLocation, bHasViewLocation);
+		NumDirtyWidgets--;
+	}
+
+	for (const TObjectKey<UGSCUserWidget>& WidgetKey : DeadWidgets)
+	{
+		RemoveWidget(WidgetKey);
+	}
+
+	// Dispatch once done iterating, widget handlers may trigger further attribute changes or (un)register widgets
+	for (const TPair<TWeakObjectPtr<UGSCUserWidget>, TArray<FPendingAttributeChange>>& DueUpdate : DueUpdates)
+	{
+		UGSCUserWidget* Widget = DueUpdate.Key.Get();
+		if (!Widget)
+		{
+			continue;
+		}
+
+		for (const FPendingAttributeChange& Change : DueUpdate.Value)
+		{
+			FOnAttributeChangeData Data;
+			Data.Attribute = Change.Attribute;
+			Data.OldValue = Change.OldValue;
+			Data.NewValue = Change.NewValue;
+			Widget->OnAttributeChanged(Data);
+		}
+	}
+}
+
+TStatId UGSCWidgetUpdateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGSCWidgetUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UGSCWidgetUpdateSubsystem::RegisterWidget(UGSCUserWidget* Widget, UAbilitySystemComponent* AbilitySystemComponent)
+{
+	LLM_SCOPE_BYTAG(GASCompanion_UI);
+	if (!Widget || !AbilitySystemComponent)
+	{
+		return;
+	}
+
+	UnregisterWidget(Widget);
+
+	const TObjectKey<UAbilitySystemComponent> AbilitySystemComponentKey(AbilitySystemComponent);
+	FAbilitySystemSubscription& Subscription = Subscriptions.FindOrAdd(AbilitySystemComponentKey);
+	if (!Subscription.AbilitySystemComponent.IsValid())
+	{
+		Subscription.AbilitySystemComponent = AbilitySystemComponent;
+
+		TArray<FGameplayAttribute> Attributes;
+		AbilitySystemComponent->GetAllAttributes(Attributes);
+
+		Subscription.AttributeHandles.Reserve(Attributes.Num());
+		for (const FGameplayAttribute& Attribute : Attributes)
+		{
+			const FDelegateHandle Handle = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCWidgetUpdateSubsystem::HandleAttributeChanged, AbilitySystemComponentKey);
+			Subscription.AttributeHandles.Emplace(Attribute, Handle);
+		}
+	}
+
+	Subscription.Widgets.Add(Widget);
+
+	FWidgetEntry& Entry = Widgets.Add(Widget);
+	Entry.Widget = Widget;
+	Entry.AbilitySystemComponent = AbilitySystemComponentKey;
+}
+
+void UGSCWidgetUpdateSubsystem::UnregisterWidget(const UGSCUserWidget* Widget)
+{
+	RemoveWidget(Widget);
+}
+
+UGSCWidgetUpdateSubsystem* UGSCWidgetUpdateSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGSCWidgetUpdateSubsystem>() : nullptr;
+}
+
+void UGSCWidgetUpdateSubsystem::RemoveWidget(const TObjectKey<UGSCUserWidget> WidgetKey)
+{
+	FWidgetEntry Entry;
+	if (!Widgets.RemoveAndCopyValue(WidgetKey, Entry))
+	{
+		return;
+	}
+
+	NumDirtyWidgets -= Entry.PendingChanges.Num() > 0 ? 1 : 0;
+
+	if (FAbilitySystemSubscription* Subscription = Subscriptions.Find(Entry.AbilitySystemComponent))
+	{
+		Subscription->Widgets.RemoveSingleSwap(WidgetKey);
+		if (Subscription->Widgets.Num() == 0)
+		{
+			Unsubscribe(*Subscription);
+			Subscriptions.Remove(Entry.AbilitySystemComponent);
+		}
+	}
+}
+
+void UGSCWidgetUpdateSubsystem::HandleAttributeChanged(const FOnAttributeChangeData& Data, const TObjectKey<UAbilitySystemComponent> AbilitySystemComponentKey)
+{
+	const FAbilitySystemSubscription* Subscription = Subscriptions.Find(AbilitySystemComponentKey);
+	if (!Subscription)
+	{
+		return;
+	}
+
+	for (const TObjectKey<UGSCUserWidget>& WidgetKey : Subscription->Widgets)
+	{
+		FWidgetEntry* Entry = Widgets.Find(WidgetKey);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		FPendingAttributeChange* PendingChange = Entry->PendingChanges.FindByPredicate([&Data](const FPendingAttributeChange& Change)
+		{
+			return Change.Attribute == Data.Attribute;
+		});
+
+		if (PendingChange)
+		{
+			// Keep the oldest OldValue, so that widget sees the whole change once
+			PendingChange->NewValue = Data.NewValue;
+			continue;
+		}
+
+		NumDirtyWidgets += Entry->PendingChanges.Num() == 0 ? 1 : 0;
+		Entry->PendingChanges.Add({ Data.Attribute, Data.OldValue, Data.NewValue });
+	}
+}
+
+void UGSCWidgetUpdateSubsystem::Unsubscribe(FAbilitySystemSubscription& Subscription)
+{
+	if (UAbilitySystemComponent* AbilitySystemComponent = Subscription.AbilitySystemComponent.Get())
+	{
+		for (const TPair<FGameplayAttribute, FDelegateHandle>& AttributeHandle : Subscription.AttributeHandles)
+		{
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AttributeHandle.Key).Remove(AttributeHandle.Value);
+		}
+	}
+
+	Subscription.AttributeHandles.Empty();
+}
+
+float UGSCWidgetUpdateSubsystem::GetUpdateInterval(const UGSCUserWidget& Widget, const FVector& ViewLocation, const bool bHasViewLocation)
+{
+	const UGSCDeveloperSettings* Settings = GetDefault<UGSCDeveloperSettings>();
+
+	const AActor* OwnerActor = Widget.GetOwningActor();
+	if (!OwnerActor || !Widget.IsVisible() || !OwnerActor->WasRecentlyRendered())
+	{
+		return Settings->WidgetUpdateHiddenInterval;
+	}
+
+	if (!bHasViewLocation)
+	{
+		return 0.f;
+	}
+
+	const double DistanceSquared = FVector::DistSquared(ViewLocation, OwnerActor->GetActorLocation());
+	if (DistanceSquared <= FMath::Square(Settings->WidgetUpdateNearDistance))
+	{
+		return 0.f;
+	}
+
+	return DistanceSquared <= FMath::Square(Settings->WidgetUpdateFarDistance) ? Settings->WidgetUpdateMidInterval : Settings->WidgetUpdateFarInterval;
+}
@@ -12,12 +12,36 @@
 #include "Components/GSCAbilityQueueComponent.h"
 #include "TimerManager.h"
 #include "Abilities/GameplayAbility.h"
+#include "Algo/BinarySearch.h"
 #include "GSCLog.h"
 
+namespace GSCUWDebugAbilityQueue_Impl
+{
+	static const FText& GetBoolText(const bool bValue)
+	{
+		static const FText TrueText = FText::FromString(TEXT("true"));
+		static const FText FalseText = FText::FromString(TEXT("false"));
+		return bValue ? TrueText : FalseText;
+	}
+
+	static const FText& GetNoneText()
+	{
+		static const FText NoneText = FText::FromString(TEXT("None"));
+		return NoneText;
+	}
+
+	static const FText& GetAllText()
+	{
+		static const FText AllText = FText::FromString(TEXT("All"));
+		return AllText;
+	}
+}
+
 void UGSCUWDebugAbilityQueue::SetOwnerActor(AActor* Actor)
 {
 	Super::SetOwnerActor(Actor);
 	OwnerAbilityQueueComponent = UGSCBlueprintFunctionLibrary::GetAbilityQueueComponent(Actor);
+	RefreshAbilityQueueState();
 }
 
 void UGSCUWDebugAbilityQueue::NativeConstruct()
@@ -27,6 +51,9 @@ void UGSCUWDebugAbilityQueue::NativeConstruct()
 	GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue Setup Delegates"))
 	FGSCDelegates::OnAddAbilityQueueFromMontageRow.AddUObject(this, &UGSCUWDebugAbilityQueue::OnAddAbilityQueueFromMontageRow);
 	FGSCDelegates::OnUpdateAllowedAbilities.AddUObject(this, &UGSCUWDebugAbilityQueue::OnUpdateAllowedAbilities);
+	FGSCDelegates::OnAbilityQueueStateChanged.AddUObject(this, &UGSCUWDebugAbilityQueue::OnAbilityQueueStateChanged);
+
+	RefreshAbilityQueueState();
 }
 
 void UGSCUWDebugAbilityQueue::NativeDestruct()
@@ -34,6 +61,12 @@ void UGSCUWDebugAbilityQueue::NativeDestruct()
 	GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue Clear off delegates"))
 	FGSCDelegates::OnAddAbilityQueueFromMontageRow.RemoveAll(this);
 	FGSCDelegates::OnUpdateAllowedAbilities.RemoveAll(this);
+	FGSCDelegates::OnAbilityQueueStateChanged.RemoveAll(this);
+
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ClearFromMontageTimerHandle);
+	}
 	
 	Super::NativeDestruct();
 }
@@ -50,26 +83,29 @@ void UGSCUWDebugAbilityQueue::OnUpdateAllowedAbilities(const TArray<TSubclassOf<
 	UpdateAllowedAbilities(Abilities);
 }
 
-void UGSCUWDebugAbilityQueue::UpdateAllowedAbilities(TArray<TSubclassOf<UGameplayAbility>> AllowedAbilities)
+void UGSCUWDebugAbilityQueue::OnAbilityQueueStateChanged(const UGSCAbilityQueueComponent* AbilityQueueComponent)
 {
-	if (AllowedAbilitiesBox && AllowedAbilityTemplateText)
+	if (AbilityQueueComponent == OwnerAbilityQueueComponent.Get())
 	{
-		GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::UpdateAllowedAbilities() clearing children"))
-		AllowedAbilitiesBox->ClearChildren();
-
-		if (OwnerAbilityQueueComponent.IsValid() && OwnerAbilityQueueComponent->IsAllAbilitiesAllowedForAbilityQueue())
-		{
-			GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::UpdateAllowedAbilities() All abilities are allowed"))
+		RefreshAbilityQueueState();
+	}
+}
 
-			UTextBlock* Text = DuplicateObject(AllowedAbilityTemplateText, this);
-			if (Text)
-			{
-				Text->SetText(FText::FromString("All"));
-				AllowedAbilitiesBox->AddChild(Text);
-			}
-			return;
-		}
+void UGSCUWDebugAbilityQueue::UpdateAllowedAbilities(TArray<TSubclassOf<UGameplayAbility>> AllowedAbilities)
+{
+	if (!AllowedAbilitiesBox || !AllowedAbilityTemplateText)
+	{
+		return;
+	}
 
+	int32 RowIndex = 0;
+	if (OwnerAbilityQueueComponent.IsValid() && OwnerAbilityQueueComponent->IsAllAbilitiesAllowedForAbilityQueue())
+	{
+		GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::UpdateAllowedAbilities() All abilities are allowed"))
+		SetRowText(GetOrCreateRow(AllowedAbilityRows, RowIndex++, AllowedAbilityTemplateText, AllowedAbilitiesBox), GSCUWDebugAbilityQueue_Impl::GetAllText());
+	}
+	else
+	{
 		for (const TSubclassOf<UGameplayAbility> Ability : AllowedAbilities)
 		{
 			if (!Ability)
@@ -77,108 +113,198 @@ void UGSCUWDebugAbilityQueue::UpdateAllowedAbilities(TArray<TSubclassOf<UGamepla
 				continue;
 			}
 
-			GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::UpdateAllowedAbilities() Adding child for %s"), *Ability->GetName())
-
-			UTextBlock* Text = DuplicateObject(AllowedAbilityTemplateText, this);
-			if (Text)
-			{
-				Text->SetText(FText::FromString(Ability->GetName()));
-				AllowedAbilitiesBox->AddChild(Text);
-			}
+			GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::UpdateAllowedAbilities() Setting row %d for %s"), RowIndex, *Ability->GetName())
+			SetRowText(GetOrCreateRow(AllowedAbilityRows, RowIndex++, AllowedAbilityTemplateText, AllowedAbilitiesBox), FText::FromString(Ability->GetName()));
 		}
 	}
+
+	CollapseRows(AllowedAbilityRows, RowIndex);
 }
 
 void UGSCUWDebugAbilityQueue::AddAbilityQueueFromMontageRow(UAnimSequenceBase* Anim, const bool bStartClearTimer)
 {
-	if (AbilityQueueFromMontagesBox && AbilityQueueFromMontageTemplateText)
+	if (!AbilityQueueFromMontagesBox || !AbilityQueueFromMontageTemplateText)
 	{
-		GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::AddAbilityQueueFromMontageRow()"))
-		// AllowedAbilitiesBox->ClearChildren();
+		return;
+	}
 
-		UTextBlock* Text = DuplicateObject(AbilityQueueFromMontageTemplateText, this);
-		if (Text)
-		{
-			GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::AddAbilityQueueFromMontageRow() Add Child Text"))
-			// Text->SetText(FText::FromString("Ability Queue Opened from Montage: " + Anim->GetName()));
-			Text->SetText(FText::FromString(Anim->GetName()));
-			Text->SetVisibility(ESlateVisibility::HitTestInvisible);
-			AbilityQueueFromMontagesBox->AddChild(Text);
-
-			// Ensure initial visibility when rows are added, if it's collapsed on clear (when no rows present)
-			if (AbilityQueueFromMontagesPanel)
-			{
-				AbilityQueueFromMontagesPanel->SetVisibility(ESlateVisibility::HitTestInvisible);
-			}
+	GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::AddAbilityQueueFromMontageRow()"))
+	FromMontageRowTexts.Add(FText::FromString(GetNameSafe(Anim)));
+	RefreshFromMontageRows();
 
-			if (bStartClearTimer)
-			{
-				StartClearFromMontageRowTimer();
-			}
-		}
+	if (bStartClearTimer)
+	{
+		StartClearFromMontageRowTimer();
 	}
 }
 
 void UGSCUWDebugAbilityQueue::StartClearFromMontageRowTimer()
 {
 	GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::StartClearFromMontageRowTimer()"))
-	FTimerHandle TimerHandle;
-	ClearFromMontageTimerHandles.Add(TimerHandle);
-	GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &UGSCUWDebugAbilityQueue::ClearFromMontageRow, ClearFromMontageDelay, false);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Each call clears the oldest row once the delay elapsed, keep expiry times sorted as delay may change in between
+	const double ClearTime = World->GetTimeSeconds() + ClearFromMontageDelay;
+	const int32 InsertIndex = Algo::UpperBound(ClearFromMontageTimes, ClearTime);
+	ClearFromMontageTimes.Insert(ClearTime, InsertIndex);
+
+	if (InsertIndex == 0)
+	{
+		ScheduleNextClearFromMontageRow();
+	}
 }
 
-void UGSCUWDebugAbilityQueue::NativeTick(const FGeometry& MyGeometry, const float InDeltaTime)
+void UGSCUWDebugAbilityQueue::RefreshAbilityQueueState()
 {
-	Super::NativeTick(MyGeometry, InDeltaTime);
-
 	if (!OwnerAbilityQueueComponent.IsValid())
 	{
-		GSC_UI_LOG(Warning, TEXT("UGSCUWDebugAbilityQueue::NativeTick() OwnerAbilityQueueComponent not valid"))
+		GSC_UI_LOG(Verbose, TEXT("UGSCUWDebugAbilityQueue::RefreshAbilityQueueState() OwnerAbilityQueueComponent not valid"))
 		return;
 	}
 
-	if (AbilityQueueEnabledText)
+	const bool bAbilityQueueEnabled = OwnerAbilityQueueComponent->bAbilityQueueEnabled;
+	SetStateText(AbilityQueueEnabledText, GSCUWDebugAbilityQueue_Impl::GetBoolText(bAbilityQueueEnabled), bAbilityQueueEnabled ? GreenColor : RedColor);
+
+	const bool bAbilityQueueOpened = OwnerAbilityQueueComponent->IsAbilityQueueOpened();
+	SetStateText(AbilityQueueOpenedText, GSCUWDebugAbilityQueue_Impl::GetBoolText(bAbilityQueueOpened), bAbilityQueueOpened ? GreenColor : RedColor);
+
+	const UGameplayAbility* Ability = OwnerAbilityQueueComponent->GetCurrentQueuedAbility();
+	SetStateText(CurrentQueuedAbilityText, Ability ? FText::FromString(Ability->GetName()) : GSCUWDebugAbilityQueue_Impl::GetNoneText(), Ability ? GreenColor : WhiteColor);
+
+	const bool bAllowAllAbilities = OwnerAbilityQueueComponent->IsAllAbilitiesAllowedForAbilityQueue();
+	SetStateText(AllowAllAbilitiesText, GSCUWDebugAbilityQueue_Impl::GetBoolText(bAllowAllAbilities), bAllowAllAbilities ? GreenColor : RedColor);
+}
+
+void UGSCUWDebugAbilityQueue::ClearFromMontageRow()
+{
+	if (FromMontageRowTexts.Num() > 0)
 	{
-		const bool bAbilityQueueEnabled = OwnerAbilityQueueComponent->bAbilityQueueEnabled;
-		AbilityQueueEnabledText->SetText(bAbilityQueueEnabled ? FText::FromString("true") : FText::FromString("false"));
-		AbilityQueueEnabledText->SetColorAndOpacity(FSlateColor(bAbilityQueueEnabled ? GreenColor : RedColor));
+		FromMontageRowTexts.RemoveAt(0);
 	}
 
-	if (AbilityQueueOpenedText)
+	RefreshFromMontageRows();
+}
+
+UTextBlock* UGSCUWDebugAbilityQueue::GetOrCreateRow(TArray<UTextBlock*>& Rows, const int32 Index, UTextBlock* Template, UVerticalBox* Box)
+{
+	if (Rows.IsValidIndex(Index))
 	{
-		const bool bAbilityQueueOpened = OwnerAbilityQueueComponent->IsAbilityQueueOpened();
-		AbilityQueueOpenedText->SetText(bAbilityQueueOpened ? FText::FromString("true") : FText::FromString("false"));
-		AbilityQueueOpenedText->SetColorAndOpacity(FSlateColor(bAbilityQueueOpened ? GreenColor : RedColor));
+		return Rows[Index];
 	}
 
-	if (CurrentQueuedAbilityText)
+	UTextBlock* Row = DuplicateObject(Template, this);
+	if (Row)
 	{
-		const UGameplayAbility* Ability = OwnerAbilityQueueComponent->GetCurrentQueuedAbility();
-		CurrentQueuedAbilityText->SetText(Ability ? FText::FromString(Ability->GetName()): FText::FromString("None"));
-		CurrentQueuedAbilityText->SetColorAndOpacity(Ability ? GreenColor : WhiteColor);
+		Box->AddChild(Row);
+		Rows.Add(Row);
 	}
 
-	if (AllowAllAbilitiesText)
+	return Row;
+}
+
+void UGSCUWDebugAbilityQueue::CollapseRows(const TArray<UTextBlock*>& Rows, const int32 Index)
+{
+	for (int32 RowIndex = Index; RowIndex < Rows.Num(); RowIndex++)
 	{
-		const bool bAllowAllAbilities = OwnerAbilityQueueComponent->IsAllAbilitiesAllowedForAbilityQueue();
-		AllowAllAbilitiesText->SetText(bAllowAllAbilities ? FText::FromString("true"): FText::FromString("false"));
-		AllowAllAbilitiesText->SetColorAndOpacity(bAllowAllAbilities ? GreenColor : RedColor);
+		if (Rows[RowIndex] && Rows[RowIndex]->GetVisibility() != ESlateVisibility::Collapsed)
+		{
+			Rows[RowIndex]->SetVisibility(ESlateVisibility::Collapsed);
+		}
 	}
 }
 
-void UGSCUWDebugAbilityQueue::ClearFromMontageRow()
+void UGSCUWDebugAbilityQueue::SetRowText(UTextBlock* Row, const FText& Text)
+{
+	if (!Row)
+	{
+		return;
+	}
+
+	if (!Row->GetText().IdenticalTo(Text, ETextIdenticalModeFlags::LexicalCompareInvariants))
+	{
+		Row->SetText(Text);
+	}
+
+	if (Row->GetVisibility() != ESlateVisibility::HitTestInvisible)
+	{
+		Row->SetVisibility(ESlateVisibility::HitTestInvisible);
+	}
+}
+
+void UGSCUWDebugAbilityQueue::SetStateText(UTextBlock* TextBlock, const FText& Text, const FLinearColor& Color)
 {
-	if (AbilityQueueFromMontagesBox)
+	if (!TextBlock)
 	{
-		AbilityQueueFromMontagesBox->RemoveChildAt(0);
+		return;
+	}
+
+	if (!TextBlock->GetText().IdenticalTo(Text, ETextIdenticalModeFlags::LexicalCompareInvariants))
+	{
+		TextBlock->SetText(Text);
+	}
+
+	if (TextBlock->ColorAndOpacity.GetSpecifiedColor() != Color)
+	{
+		TextBlock->SetColorAndOpacity(FSlateColor(Color));
+	}
+}
 
-		if (AbilityQueueFromMontagesPanel)
+void UGSCUWDebugAbilityQueue::RefreshFromMontageRows()
+{
+	if (!AbilityQueueFromMontagesBox || !AbilityQueueFromMontageTemplateText)
+	{
+		return;
+	}
+
+	for (int32 RowIndex = 0; RowIndex < FromMontageRowTexts.Num(); RowIndex++)
+	{
+		SetRowText(GetOrCreateRow(FromMontageRows, RowIndex, AbilityQueueFromMontageTemplateText, AbilityQueueFromMontagesBox), FromMontageRowTexts[RowIndex]);
+	}
+
+	CollapseRows(FromMontageRows, FromMontageRowTexts.Num());
+
+	// Ensure visibility when rows are added, collapse it when no rows present
+	if (AbilityQueueFromMontagesPanel)
+	{
+		const ESlateVisibility PanelVisibility = FromMontageRowTexts.Num() > 0 ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed;
+		if (AbilityQueueFromMontagesPanel->GetVisibility() != PanelVisibility)
 		{
-			const int32 ChildrenCount = AbilityQueueFromMontagesBox->GetChildrenCount();
-			if (ChildrenCount == 0)
-			{
-				AbilityQueueFromMontagesPanel->SetVisibility(ESlateVisibility::Collapsed);
-			}
+			AbilityQueueFromMontagesPanel->SetVisibility(PanelVisibility);
 		}
 	}
 }
+
+void UGSCUWDebugAbilityQueue::ScheduleNextClearFromMontageRow()
+{
+	UWorld* World = GetWorld();
+	if (!World || ClearFromMontageTimes.Num() == 0)
+	{
+		return;
+	}
+
+	const float Delay = FMath::Max(static_cast<float>(ClearFromMontageTimes[0] - World->GetTimeSeconds()), KINDA_SMALL_NUMBER);
+	World->GetTimerManager().SetTimer(ClearFromMontageTimerHandle, this, &UGSCUWDebugAbilityQueue::OnClearFromMontageTimer, Delay, false);
+}
+
+void UGSCUWDebugAbilityQueue::OnClearFromMontageTimer()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	while (ClearFromMontageTimes.Num() > 0 && ClearFromMontageTimes[0] <= Now)
+	{
+		ClearFromMontageTimes.RemoveAt(0);
+		ClearFromMontageRow();
+	}
+
+	ScheduleNextClearFromMontageRow();
+}
@@ -8,51 +8,89 @@
 #include "Abilities/Attributes/GSCAttributeSet.h"
 #include "Components/TextBlock.h"
 #include "Components/ProgressBar.h"
+#include "GSCDelegates.h"
 #include "GSCLog.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("GSC HUD Refresh Attributes"), STAT_GSCHudRefreshAttributes, STATGROUP_Slate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GSC HUD Attribute SetText"), STAT_GSCHudAttributeSetText, STATGROUP_Slate);
+
+namespace GSCUWHud_Impl
+{
+	/** Max number of formatted "Value / MaxValue" texts kept around, the cache is flushed when reached */
+	constexpr int32 MaxCachedAttributeTexts = 256;
+}
 
 void UGSCUWHud::NativeConstruct()
 {
 	Super::NativeConstruct();
 
-	if (APawn* OwningPlayerPawn = GetOwningPlayerPawn())
+	APawn* OwningPlayerPawn = GetOwningPlayerPawn();
+	if (OwningPlayerPawn)
 	{
 		SetOwnerActor(OwningPlayerPawn);
+	}
 
-		if (!TryInitAbilitySystem())
-		{
-			GSC_LOG(Warning, TEXT("UGSCUWHud::NativeConstruct called too early: %s (%s)"), *GetNameSafe(AbilitySystemComponent), *GetNameSafe(OwningPlayerPawn))
-			bLazyAbilitySystemInitialization = true;
-		}
+	if (!OwningPlayerPawn || !TryInitAbilitySystem())
+	{
+		GSC_LOG(Log, TEXT("UGSCUWHud::NativeConstruct called too early, waiting for ASC initialization: %s (%s)"), *GetNameSafe(AbilitySystemComponent), *GetNameSafe(OwningPlayerPawn))
+		bLazyAbilitySystemInitialization = true;
+		LazyInitializationStartFrame = GFrameCounter;
+		LazyInitializationStartTime = FPlatformTime::Seconds();
+		FGSCDelegates::OnAbilityActorInfoInitialized.AddUObject(this, &UGSCUWHud::HandleAbilityActorInfoInitialized);
 	}
 }
 
 void UGSCUWHud::NativeDestruct()
 {
+	StopLazyAbilitySystemInitialization();
+
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(RefreshAttributesTimerHandle);
+	}
+
 	// Clean up previously registered delegates for OwningPlayer AbilitySystemComponent
 	ResetAbilitySystem();
 
 	Super::NativeDestruct();
 }
 
-void UGSCUWHud::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UGSCUWHud::HandleAbilityActorInfoInitialized(UAbilitySystemComponent* InAbilitySystemComponent)
 {
-	Super::NativeTick(MyGeometry, InDeltaTime);
-
-	// Lazy init disabled, was either good from native construct or initialized once here
-	if (!bLazyAbilitySystemInitialization)
+	APawn* OwningPlayerPawn = GetOwningPlayerPawn();
+	if (!InAbilitySystemComponent || !OwningPlayerPawn || InAbilitySystemComponent->GetAvatarActor() != OwningPlayerPawn)
 	{
 		return;
 	}
 
+	if (OwnerActor != OwningPlayerPawn)
+	{
+		SetOwnerActor(OwningPlayerPawn);
+	}
+
+	AbilitySystemComponent = InAbilitySystemComponent;
 	if (TryInitAbilitySystem())
 	{
-		// We now have proper ASC and initialized widget, prevent further tick run
-		bLazyAbilitySystemInitialization = false;
-		
-		GSC_LOG(Warning, TEXT("UGSCUWHud::NativeTick reconciliated with ASC. We now have a reference to it: %s (%s)"), *GetNameSafe(AbilitySystemComponent), *GetNameSafe(OwnerActor))
+		GSC_LOG(
+			Log,
+			TEXT("UGSCUWHud::HandleAbilityActorInfoInitialized reconciliated with ASC after %llu frames (%.2f ms): %s (%s)"),
+			GFrameCounter - LazyInitializationStartFrame,
+			(FPlatformTime::Seconds() - LazyInitializationStartTime) * 1000.0,
+			*GetNameSafe(AbilitySystemComponent),
+			*GetNameSafe(OwnerActor)
+		)
+
+		StopLazyAbilitySystemInitialization();
 	}
 }
 
+void UGSCUWHud::StopLazyAbilitySystemInitialization()
+{
+	bLazyAbilitySystemInitialization = false;
+	FGSCDelegates::OnAbilityActorInfoInitialized.RemoveAll(this);
+}
+
 void UGSCUWHud::InitFromCharacter()
 {
 	if (!AbilitySystemComponent)
@@ -61,6 +99,14 @@ void UGSCUWHud::InitFromCharacter()
 		return;
 	}
 
+	HealthState.MaxValue = GetAttributeValue(UGSCAttributeSet::GetMaxHealthAttribute());
+	StaminaState.MaxValue = GetAttributeValue(UGSCAttributeSet::GetMaxStaminaAttribute());
+	ManaState.MaxValue = GetAttributeValue(UGSCAttributeSet::GetMaxManaAttribute());
+
+	HealthState.ResetDisplayed();
+	StaminaState.ResetDisplayed();
+	ManaState.ResetDisplayed();
+
 	SetHealth(GetAttributeValue(UGSCAttributeSet::GetHealthAttribute()));
 	SetStamina(GetAttributeValue(UGSCAttributeSet::GetStaminaAttribute()));
 	SetMana(GetAttributeValue(UGSCAttributeSet::GetManaAttribute()));
@@ -68,29 +114,28 @@ void UGSCUWHud::InitFromCharacter()
 
 void UGSCUWHud::SetMaxHealth(const float MaxHealth)
 {
-	const float Health = GetAttributeValue(UGSCAttributeSet::GetHealthAttribute());
-	if (HealthText)
-	{
-		HealthText->SetText(FText::FromString(GetAttributeFormatString(Health, MaxHealth)));
-	}
+	HealthState.MaxValue = MaxHealth;
+	HealthState.Value = GetAttributeValue(UGSCAttributeSet::GetHealthAttribute());
+	HealthState.bDirty = false;
+	UpdateAttributeText(HealthState, HealthText);
 
-	if (MaxHealth != 0)
+	float Percent;
+	if (ShouldUpdateAttributePercent(HealthState, Percent))
 	{
-		SetHealthPercentage(Health / MaxHealth);
+		SetHealthPercentage(Percent);
 	}
 }
 
 void UGSCUWHud::SetHealth(const float Health)
 {
-	const float MaxHealth = GetAttributeValue(UGSCAttributeSet::GetMaxHealthAttribute());
-	if (HealthText)
-	{
-		HealthText->SetText(FText::FromString(GetAttributeFormatString(Health, MaxHealth)));
-	}
+	HealthState.Value = Health;
+	HealthState.bDirty = false;
+	UpdateAttributeText(HealthState, HealthText);
 
-	if (MaxHealth != 0)
+	float Percent;
+	if (ShouldUpdateAttributePercent(HealthState, Percent))
 	{
-		SetHealthPercentage(Health / MaxHealth);
+		SetHealthPercentage(Percent);
 	}
 }
 
@@ -104,29 +149,28 @@ void UGSCUWHud::SetHealthPercentage(const float HealthPercentage)
 
 void UGSCUWHud::SetMaxStamina(const float MaxStamina)
 {
-	const float Stamina = GetAttributeValue(UGSCAttributeSet::GetStaminaAttribute());
-	if (StaminaText)
-	{
-		StaminaText->SetText(FText::FromString(GetAttributeFormatString(Stamina, MaxStamina)));
-	}
+	StaminaState.MaxValue = MaxStamina;
+	StaminaState.Value = GetAttributeValue(UGSCAttributeSet::GetStaminaAttribute());
+	StaminaState.bDirty = false;
+	UpdateAttributeText(StaminaState, StaminaText);
 
-	if (MaxStamina != 0)
+	float Percent;
+	if (ShouldUpdateAttributePercent(StaminaState, Percent))
 	{
-		SetStaminaPercentage(Stamina / MaxStamina);
+		SetStaminaPercentage(Percent);
 	}
 }
 
 void UGSCUWHud::SetStamina(const float Stamina)
 {
-	const float MaxStamina = GetAttributeValue(UGSCAttributeSet::GetMaxStaminaAttribute());
-	if (StaminaText)
-	{
-		StaminaText->SetText(FText::FromString(GetAttributeFormatString(Stamina, MaxStamina)));
-	}
+	StaminaState.Value = Stamina;
+	StaminaState.bDirty = false;
+	UpdateAttributeText(StaminaState, StaminaText);
 
-	if (MaxStamina != 0)
+	float Percent;
+	if (ShouldUpdateAttributePercent(StaminaState, Percent))
 	{
-		SetStaminaPercentage(Stamina / MaxStamina);
+		SetStaminaPercentage(Percent);
 	}
 }
 
@@ -140,29 +184,28 @@ void UGSCUWHud::SetStaminaPercentage(const float StaminaPercentage)
 
 void UGSCUWHud::SetMaxMana(const float MaxMana)
 {
-	const float Mana = GetAttributeValue(UGSCAttributeSet::GetManaAttribute());
-	if (ManaText)
-	{
-		ManaText->SetText(FText::FromString(GetAttributeFormatString(Mana, MaxMana)));
-	}
+	ManaState.MaxValue = MaxMana;
+	ManaState.Value = GetAttributeValue(UGSCAttributeSet::GetManaAttribute());
+	ManaState.bDirty = false;
+	UpdateAttributeText(ManaState, ManaText);
 
-	if (MaxMana != 0)
+	float Percent;
+	if (ShouldUpdateAttributePercent(ManaState, Percent))
 	{
-		SetManaPercentage(Mana / MaxMana);
+		SetManaPercentage(Percent);
 	}
 }
 
 void UGSCUWHud::SetMana(const float Mana)
 {
-	const float MaxMana = GetAttributeValue(UGSCAttributeSet::GetMaxManaAttribute());
-	if (ManaText)
-	{
-		ManaText->SetText(FText::FromString(GetAttributeFormatString(Mana, MaxMana)));
-	}
+	ManaState.Value = Mana;
+	ManaState.bDirty = false;
+	UpdateAttributeText(ManaState, ManaText);
 
-	if (MaxMana != 0)
+	float Percent;
+	if (ShouldUpdateAttributePercent(ManaState, Percent))
 	{
-		SetManaPercentage(Mana / MaxMana);
+		SetManaPercentage(Percent);
 	}
 }
 
@@ -176,30 +219,153 @@ void UGSCUWHud::SetManaPercentage(const float ManaPercentage)
 
 void UGSCUWHud::HandleAttributeChange(const FGameplayAttribute Attribute, const float NewValue, const float OldValue)
 {
+	// Only record the new value here, widgets are refreshed once for all changes that happened in the same frame / interval
 	if (Attribute == UGSCAttributeSet::GetHealthAttribute())
 	{
-		SetHealth(NewValue);
+		HealthState.Value = NewValue;
+		MarkAttributeDirty(HealthState);
 	}
 	else if (Attribute == UGSCAttributeSet::GetStaminaAttribute())
 	{
-		SetStamina(NewValue);
+		StaminaState.Value = NewValue;
+		MarkAttributeDirty(StaminaState);
 	}
 	else if (Attribute == UGSCAttributeSet::GetManaAttribute())
 	{
-		SetMana(NewValue);
+		ManaState.Value = NewValue;
+		MarkAttributeDirty(ManaState);
 	}
 	else if (Attribute == UGSCAttributeSet::GetMaxHealthAttribute())
 	{
-		SetMaxHealth(NewValue);
+		HealthState.MaxValue = NewValue;
+		MarkAttributeDirty(HealthState, true);
 	}
 	else if (Attribute == UGSCAttributeSet::GetMaxStaminaAttribute())
 	{
-		SetMaxStamina(NewValue);
+		StaminaState.MaxValue = NewValue;
+		MarkAttributeDirty(StaminaState, true);
 	}
 	else if (Attribute == UGSCAttributeSet::GetMaxManaAttribute())
 	{
-		SetMaxMana(NewValue);
+		ManaState.MaxValue = NewValue;
+		MarkAttributeDirty(ManaState, true);
+	}
+}
+
+void UGSCUWHud::MarkAttributeDirty(FAttributeWidgetState& State, const bool bMaxValue)
+{
+	State.bDirty = true;
+	State.bMaxDirty |= bMaxValue;
+
+	if (RefreshAttributesTimerHandle.IsValid())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		RefreshDirtyAttributes();
+		return;
+	}
+
+	if (AttributeRefreshInterval > 0.f)
+	{
+		World->GetTimerManager().SetTimer(RefreshAttributesTimerHandle, FTimerDelegate::CreateUObject(this, &UGSCUWHud::RefreshDirtyAttributes), AttributeRefreshInterval, false);
 	}
+	else
+	{
+		RefreshAttributesTimerHandle = World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UGSCUWHud::RefreshDirtyAttributes));
+	}
+}
+
+void UGSCUWHud::RefreshDirtyAttributes()
+{
+	SCOPE_CYCLE_COUNTER(STAT_GSCHudRefreshAttributes);
+
+	RefreshAttributesTimerHandle.Invalidate();
+
+	// Go through the virtual setters, so that overrides see max attribute changes as SetMax* calls (which also pick up the current value)
+	if (HealthState.bMaxDirty)
+	{
+		HealthState.bMaxDirty = false;
+		SetMaxHealth(HealthState.MaxValue);
+	}
+	else if (HealthState.bDirty)
+	{
+		SetHealth(HealthState.Value);
+	}
+
+	if (StaminaState.bMaxDirty)
+	{
+		StaminaState.bMaxDirty = false;
+		SetMaxStamina(StaminaState.MaxValue);
+	}
+	else if (StaminaState.bDirty)
+	{
+		SetStamina(StaminaState.Value);
+	}
+
+	if (ManaState.bMaxDirty)
+	{
+		ManaState.bMaxDirty = false;
+		SetMaxMana(ManaState.MaxValue);
+	}
+	else if (ManaState.bDirty)
+	{
+		SetMana(ManaState.Value);
+	}
+}
+
+const FText& UGSCUWHud::GetAttributeText(const int32 Value, const int32 MaxValue)
+{
+	static TMap<uint64, FText> CachedTexts;
+
+	const uint64 Key = static_cast<uint64>(static_cast<uint32>(Value)) << 32 | static_cast<uint32>(MaxValue);
+	if (const FText* CachedText = CachedTexts.Find(Key))
+	{
+		return *CachedText;
+	}
+
+	if (CachedTexts.Num() >= GSCUWHud_Impl::MaxCachedAttributeTexts)
+	{
+		CachedTexts.Reset();
+	}
+
+	return CachedTexts.Add(Key, FText::FromString(GetAttributeFormatString(Value, MaxValue)));
+}
+
+void UGSCUWHud::UpdateAttributeText(FAttributeWidgetState& State, UTextBlock* TextBlock)
+{
+	const int32 Value = FMath::FloorToInt(State.Value);
+	const int32 MaxValue = FMath::FloorToInt(State.MaxValue);
+	if (!TextBlock || (Value == State.DisplayedValue && MaxValue == State.DisplayedMaxValue))
+	{
+		return;
+	}
+
+	State.DisplayedValue = Value;
+	State.DisplayedMaxValue = MaxValue;
+
+	INC_DWORD_STAT(STAT_GSCHudAttributeSetText);
+	TextBlock->SetText(GetAttributeText(Value, MaxValue));
+}
+
+bool UGSCUWHud::ShouldUpdateAttributePercent(FAttributeWidgetState& State, float& OutPercent)
+{
+	if (State.MaxValue == 0)
+	{
+		return false;
+	}
+
+	OutPercent = State.Value / State.MaxValue;
+	if (FMath::IsNearlyEqual(OutPercent, State.DisplayedPercent))
+	{
+		return false;
+	}
+
+	State.DisplayedPercent = OutPercent;
+	return true;
 }
 
 FString UGSCUWHud::GetAttributeFormatString(const float BaseValue, const float MaxValue)
@@ -3,12 +3,13 @@
 
 #include "UI/GSCUserWidget.h"
 
-#include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GameplayEffectTypes.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
+#include "Subsystems/GSCWidgetUpdateSubsystem.h"
 #include "GSCLog.h"
+#include "GSCStats.h"
 
 void UGSCUserWidget::SetOwnerActor(AActor* Actor)
 {
@@ -43,6 +44,31 @@ void UGSCUserWidget::InitializeWithAbilitySystem(const UAbilitySystemComponent*
 	OnAbilitySystemInitialized();
 }
 
+void UGSCUserWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	// Registered again if this widget was destructed (removed from its parent) and is constructed again
+	if (bUseSharedUpdateScheduler && AbilitySystemComponent)
+	{
+		if (UGSCWidgetUpdateSubsystem* WidgetUpdateSubsystem = UGSCWidgetUpdateSubsystem::Get(this))
+		{
+			WidgetUpdateSubsystem->RegisterWidget(this, AbilitySystemComponent);
+		}
+	}
+}
+
+void UGSCUserWidget::NativeDestruct()
+{
+	// Widget Update Subsystem only holds weak references, make sure this widget doesn't linger in there until next update
+	if (UGSCWidgetUpdateSubsystem* WidgetUpdateSubsystem = UGSCWidgetUpdateSubsystem::Get(this))
+	{
+		WidgetUpdateSubsystem->UnregisterWidget(this);
+	}
+
+	Super::NativeDestruct();
+}
+
 void UGSCUserWidget::ResetAbilitySystem()
 {
 	ShutdownAbilitySystemComponentListeners();
@@ -51,19 +77,29 @@ void UGSCUserWidget::ResetAbilitySystem()
 
 void UGSCUserWidget::RegisterAbilitySystemDelegates()
 {
+	LLM_SCOPE_BYTAG(GASCompanion_UI);
 	if (!AbilitySystemComponent)
 	{
 		// Ability System may not have been available yet for character (PlayerState setup on clients)
 		return;
 	}
 
-	TArray<FGameplayAttribute> Attributes;
-	AbilitySystemComponent->GetAllAttributes(Attributes);
-
-	for (FGameplayAttribute Attribute : Attributes)
+	UGSCWidgetUpdateSubsystem* WidgetUpdateSubsystem = bUseSharedUpdateScheduler ? UGSCWidgetUpdateSubsystem::Get(this) : nullptr;
+	if (WidgetUpdateSubsystem)
 	{
-		GSC_LOG(Verbose, TEXT("UGSCUserWidget::SetupAbilitySystemComponentListeners - Setup callback for %s (%s)"), *Attribute.GetName(), *GetNameSafe(OwnerActor));
-		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCUserWidget::OnAttributeChanged);
+		// Attribute changes are batched and dispatched by the subsystem
+		WidgetUpdateSubsystem->RegisterWidget(this, AbilitySystemComponent);
+	}
+	else
+	{
+		TArray<FGameplayAttribute> Attributes;
+		AbilitySystemComponent->GetAllAttributes(Attributes);
+
+		for (FGameplayAttribute Attribute : Attributes)
+		{
+			GSC_LOG(Verbose, TEXT("UGSCUserWidget::SetupAbilitySystemComponentListeners - Setup callback for %s (%s)"), *Attribute.GetName(), *GetNameSafe(OwnerActor));
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UGSCUserWidget::OnAttributeChanged);
+		}
 	}
 
 	// Handle GameplayEffects added / remove
@@ -84,6 +120,11 @@ void UGSCUserWidget::ShutdownAbilitySystemComponentListeners() const
 		return;
 	}
 
+	if (UGSCWidgetUpdateSubsystem* WidgetUpdateSubsystem = UGSCWidgetUpdateSubsystem::Get(this))
+	{
+		WidgetUpdateSubsystem->UnregisterWidget(this);
+	}
+
 	TArray<FGameplayAttribute> Attributes;
 	AbilitySystemComponent->GetAllAttributes(Attributes);
 
@@ -249,6 +290,8 @@ void UGSCUserWidget::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect& Eff
 
 	// Broadcast any GameplayEffect change to HUD
 	HandleGameplayEffectStackChange(AssetTags, GrantedTags, EffectRemoved.Handle, 0, 1);
+
+	TGuardValue<const FActiveGameplayEffect*> RemovedEffectGuard(RemovedGameplayEffect, &EffectRemoved);
 	HandleGameplayEffectRemoved(AssetTags, GrantedTags, EffectRemoved.Handle);
 }
 
@@ -378,13 +421,23 @@ void UGSCUserWidget::HandleCooldownEnd(UGameplayAbility* Ability, const FGamepla
 	OnCooldownEnd(Ability, CooldownTag, Duration);
 }
 
-FGSCGameplayEffectUIData UGSCUserWidget::GetGameplayEffectUIData(const FActiveGameplayEffectHandle ActiveHandle)
+FGSCGameplayEffectUIData UGSCUserWidget::GetGameplayEffectUIData(const FActiveGameplayEffectHandle ActiveHandle) const
 {
-	return FGSCGameplayEffectUIData(
-		UAbilitySystemBlueprintLibrary::GetActiveGameplayEffectStartTime(ActiveHandle),
-		UAbilitySystemBlueprintLibrary::GetActiveGameplayEffectTotalDuration(ActiveHandle),
-		UAbilitySystemBlueprintLibrary::GetActiveGameplayEffectExpectedEndTime(ActiveHandle),
-		UAbilitySystemBlueprintLibrary::GetActiveGameplayEffectStackCount(ActiveHandle),
-		UAbilitySystemBlueprintLibrary::GetActiveGameplayEffectStackLimitCount(ActiveHandle)
-	);
+	if (RemovedGameplayEffect && RemovedGameplayEffect->Handle == ActiveHandle)
+	{
+		return UGSCBlueprintFunctionLibrary::MakeGameplayEffectUIData(*RemovedGameplayEffect);
+	}
+
+	// Single lookup in our own ASC active effects, instead of resolving the handle owner for every field
+	if (AbilitySystemComponent)
+	{
+		if (const FActiveGameplayEffect* ActiveGameplayEffect = AbilitySystemComponent->GetActiveGameplayEffect(ActiveHandle))
+		{
+			return UGSCBlueprintFunctionLibrary::MakeGameplayEffectUIData(*ActiveGameplayEffect);
+		}
+	}
+
+	FGSCGameplayEffectUIData EffectData;
+	UGSCBlueprintFunctionLibrary::GetActiveGameplayEffectUIData(ActiveHandle, EffectData);
+	return EffectData;
 }
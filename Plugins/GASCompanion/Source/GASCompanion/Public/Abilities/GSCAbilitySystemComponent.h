@@ -60,7 +60,10 @@ struct FGSCMappedAbility
 	GENERATED_BODY()
 
 	FGameplayAbilitySpecHandle Handle;
-	FGameplayAbilitySpec Spec;
+
+	/** Granted ability class. The full spec lives in ActivatableAbilities and can be retrieved with FindAbilitySpecFromHandle() */
+	UPROPERTY(Transient)
+	TSubclassOf<UGameplayAbility> Ability;
 
 	UPROPERTY(Transient)
 	UInputAction* InputAction;
@@ -69,15 +72,117 @@ struct FGSCMappedAbility
 	{
 	}
 
-	FGSCMappedAbility(const FGameplayAbilitySpecHandle& Handle, const FGameplayAbilitySpec& Spec, UInputAction* const InputAction)
+	FGSCMappedAbility(const FGameplayAbilitySpecHandle& Handle, const TSubclassOf<UGameplayAbility> Ability, UInputAction* const InputAction)
 		: Handle(Handle),
-		  Spec(Spec),
+		  Ability(Ability),
 		  InputAction(InputAction)
 	{
 	}
 };
 
+/** Granted ability entry of a FGSCAbilitySystemSnapshot. InputID is not part of it, input binding component assigns new ones on restore. */
+USTRUCT()
+struct FGSCAbilitySnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<UGameplayAbility> Ability;
+
+	UPROPERTY()
+	int32 Level = 1;
+};
+
+/** Attribute base value entry of a FGSCAbilitySystemSnapshot */
+USTRUCT()
+struct FGSCAttributeSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayAttribute Attribute;
+
+	UPROPERTY()
+	float BaseValue = 0.f;
+};
+
+/** Durable (infinite duration) gameplay effect entry of a FGSCAbilitySystemSnapshot, applied by the captured ASC to itself */
+USTRUCT()
+struct FGSCEffectSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<UGameplayEffect> Effect;
+
+	UPROPERTY()
+	float Level = 1.f;
+
+	UPROPERTY()
+	int32 StackCount = 1;
+
+	/** Context the effect was originally applied with, re-used on restore (with instigator updated to the restoring ASC owner) */
+	UPROPERTY()
+	FGameplayEffectContextHandle Context;
+};
+
+/**
+ * Compact Ability System Component state, carried over seamless travel and reconnects by AGSCModularPlayerState
+ * (CopyProperties / OverrideWith) so that the new ASC doesn't have to go through the whole grant / initialization again.
+ */
+USTRUCT()
+struct FGSCAbilitySystemSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FGSCAbilitySnapshot> Abilities;
+
+	UPROPERTY()
+	TArray<TSubclassOf<UAttributeSet>> AttributeSets;
+
+	UPROPERTY()
+	TArray<FGSCAttributeSnapshot> Attributes;
+
+	UPROPERTY()
+	TArray<FGSCEffectSnapshot> Effects;
+
+	bool IsEmpty() const
+	{
+		return Abilities.Num() == 0 && AttributeSets.Num() == 0 && Effects.Num() == 0;
+	}
+};
+
+/** A single sync point signal, multiplexed with others in one RPC by UGSCAbilitySystemComponent sync channel */
+USTRUCT()
+struct FGSCNetSyncPointSignal
+{
+	GENERATED_BODY()
+
+	/** Ability instance the signal is for */
+	UPROPERTY()
+	FGameplayAbilitySpecHandle AbilityHandle;
+
+	/** Activation prediction key of the ability */
+	UPROPERTY()
+	FPredictionKey AbilityOriginalPredictionKey;
+
+	/** Scoped prediction key when the signal was raised (only relevant for client to server signals) */
+	UPROPERTY()
+	FPredictionKey CurrentPredictionKey;
+
+	/**
+	 * Number of gameplay events released on the server by this signal (see UGSCTask_PlayMontageWaitForEvent coalesced sync).
+	 *
+	 * 0 for a regular sync point signal. Otherwise this is the batch boundary decided by the client, the server dispatches
+	 * exactly that many of its own pending events when receiving it.
+	 */
+	UPROPERTY()
+	uint8 NumBatchedEvents = 0;
+};
+
 DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnGiveAbility, FGameplayAbilitySpec&);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FGSCOnSyncEventBatchReceived, FGameplayAbilitySpecHandle /*AbilityHandle*/, FPredictionKey /*AbilityOriginalPredictionKey*/, int32 /*NumEvents*/);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnInitAbilityActorInfo);
 
 /**
@@ -125,11 +230,24 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Abilities")
 	bool bResetAttributesOnSpawn = true;
 
+	/**
+	 * Profile of this component. Crowd is a lightweight profile meant for AI only actors (eg. large crowds), see EGSCAbilitySystemProfile.
+	 *
+	 * Must be set before InitAbilityActorInfo (eg. from owner PreInitializeComponents, AGSCModularCharacter does it with its own
+	 * AbilitySystemProfile when it is not Full).
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "GAS Companion|Abilities")
+	EGSCAbilitySystemProfile Profile = EGSCAbilitySystemProfile::Full;
+
 	/** Delegate invoked OnGiveAbility (when an ability is granted and available) */
 	FGSCOnGiveAbility OnGiveAbilityDelegate;
 
+	/** Delegate invoked on the server when a batch of coalesced gameplay events is confirmed by the owning client (see QueueSyncEventBatchSignal) */
+	FGSCOnSyncEventBatchReceived OnSyncEventBatchReceived;
+
 	//~ Begin UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~ End UActorComponent interface
 
 	//~ Begin UObject interface
@@ -144,6 +262,14 @@ public:
 	 * (if child of GSCMeleeAbility, will activate combo via combo component)
 	 */
 	virtual void AbilityLocalInputPressed(int32 InputID) override;
+
+	/** Overrides NotifyAbilityEnded to trigger UGSCGameplayAbility::AbilityEnded, independently of OnAbilityEndedCallback (which child classes may override) */
+	virtual void NotifyAbilityEnded(FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, bool bWasCancelled) override;
+
+	/** Those are overridden to flush pending client sync point signals first, so that the server receives them in the order they were raised */
+	virtual void CallServerTryActivateAbility(FGameplayAbilitySpecHandle AbilityToActivate, bool InputPressed, FPredictionKey PredictionKey) override;
+	virtual void CallServerSetReplicatedTargetData(FGameplayAbilitySpecHandle AbilityHandle, FPredictionKey AbilityOriginalPredictionKey, const FGameplayAbilityTargetDataHandle& ReplicatedTargetDataHandle, FGameplayTag ApplicationTag, FPredictionKey CurrentPredictionKey) override;
+	virtual void CallServerEndAbility(FGameplayAbilitySpecHandle AbilityToEnd, FGameplayAbilityActivationInfo ActivationInfo, FPredictionKey PredictionKey) override;
 	//~ End UAbilitySystemComponent interface
 
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "GAS Companion|Abilities")
@@ -153,10 +279,63 @@ public:
 	virtual void OnAbilityActivatedCallback(UGameplayAbility* Ability);
 	virtual void OnAbilityFailedCallback(const UGameplayAbility* Ability, const FGameplayTagContainer& Tags);
 	virtual void OnAbilityEndedCallback(UGameplayAbility* Ability);
+	virtual void OnAbilityCommittedCallback(UGameplayAbility* Ability);
+
+	/**
+	 * Queue a generic replicated event signal (GenericSignalFromClient / GenericSignalFromServer) on this ASC sync channel.
+	 *
+	 * Every signal queued during a frame is sent to the remote end in a single RPC, right before the net driver flushes
+	 * (instead of one ServerSetReplicatedEvent / ClientSetReplicatedEvent RPC per sync point). Pending client signals are
+	 * flushed early if another ability RPC goes out to the server in the meantime.
+	 */
+	void QueueSyncPointSignal(EAbilityGenericReplicatedEvent::Type EventType, FGameplayAbilitySpecHandle AbilityHandle, FPredictionKey AbilityOriginalPredictionKey, FPredictionKey CurrentPredictionKey = FPredictionKey());
+
+	/**
+	 * Adds one gameplay event to the batch signal sent to the server for this ability, used by UGSCTask_PlayMontageWaitForEvent coalesced sync.
+	 *
+	 * Every event queued before the sync channel is flushed (end of frame, or next ability RPC to the server) goes in the same signal,
+	 * along with the number of events it holds. Always sent through the sync channel, regardless of GASCompanion.NetSync.Multiplex.
+	 *
+	 * @return true if the event started a new batch, false if it joined a pending one
+	 */
+	bool QueueSyncEventBatchSignal(FGameplayAbilitySpecHandle AbilityHandle, FPredictionKey AbilityOriginalPredictionKey, FPredictionKey CurrentPredictionKey);
+
+	/** Returns whether sync points should go through the multiplexed sync channel (GASCompanion.NetSync.Multiplex) */
+	static bool IsSyncChannelEnabled();
+
+	/** Returns memory allocated by GAS Companion bookkeeping on this component (mapped abilities, input binding delegates, sync channel queues). Used by GASCompanion.Memory.Report */
+	SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * Captures granted abilities (class and level), attribute sets with their attributes base value, and durable effects
+	 * (infinite duration, applied by this component to itself, not applied by an ability nor part of GrantedEffects). Authority only.
+	 *
+	 * Abilities and effects granted by Game Features (UGSCGameFeatureAction_AddAbilities) are excluded, they are granted again
+	 * by the Game Feature action for the new actor.
+	 */
+	void CaptureSnapshot(FGSCAbilitySystemSnapshot& OutSnapshot) const;
+
+	/**
+	 * Restores a snapshot captured by CaptureSnapshot in one batch. Authority only.
+	 *
+	 * Abilities are only restored when bResetAbilitiesOnSpawn is false, and attributes / effects only when bResetAttributesOnSpawn
+	 * is false, as they would be reset on next InitAbilityActorInfo otherwise. Abilities and attribute sets already present are kept,
+	 * and are not granted / initialized again by GrantDefaultAbilitiesAndAttributes. Abilities are granted without input ID, the
+	 * input binding component assigns them (UGSCInputIDSubsystem) when binding input.
+	 */
+	void RestoreSnapshot(const FGSCAbilitySystemSnapshot& Snapshot);
 
 	/** Called when Ability System Component is initialized from InitAbilityActorInfo */
 	virtual void GrantDefaultAbilitiesAndAttributes(AActor* InOwnerActor, AActor* InAvatarActor);
 
+	/** Reinit the cached ability actor info (specifically the player controller). Called by UGSCPawnControllerSubsystem when owning pawn controller changes. */
+	virtual void OnPawnControllerChanged(APawn* Pawn, AController* NewController);
+
+	/** Sets the profile of this component, forcing Minimal replication mode for Crowd */
+	void SetProfile(EGSCAbilitySystemProfile NewProfile);
+
+	bool IsCrowdProfile() const { return Profile == EGSCAbilitySystemProfile::Crowd; }
+
 	/** Called from GrantDefaultAbilitiesAndAttributes. Determine if ability should be granted, prevents re-adding an ability previously granted in case bResetAbilitiesOnSpawn is set to false */
 	virtual bool ShouldGrantAbility(TSubclassOf<UGameplayAbility> Ability);
 
@@ -190,6 +369,13 @@ protected:
 	// Keep track of OnGiveAbility handles bound to handle input binding on clients
 	TArray<FDelegateHandle> InputBindingDelegateHandles;
 
+	// Sync point signals waiting to be sent to the server / owning client
+	TArray<FGSCNetSyncPointSignal> PendingServerSyncSignals;
+	TArray<FGSCNetSyncPointSignal> PendingClientSyncSignals;
+
+	// Handle to the world post actor tick delegate, only bound while signals are pending
+	FDelegateHandle FlushSyncSignalsHandle;
+
 	// Cached ComboComponent on Character (if it has any)
 	UPROPERTY()
 	UGSCComboManagerComponent* ComboComponent;
@@ -201,10 +387,24 @@ protected:
 	/** Called when Ability System Component is initialized */
 	void GrantStartupEffects();
 
-	/** Reinit the cached ability actor info (specifically the player controller) */
-	UFUNCTION()
-	void OnPawnControllerChanged(APawn* Pawn, AController* NewController);
+	/** Stops routing controller changes of owning pawn to this component (see UGSCPawnControllerSubsystem) */
+	void UnregisterFromPawnControllerSubsystem() const;
+
+	/** Sends every pending sync point signal, one RPC per direction (per MaxSyncPointSignalsPerRPC signals) */
+	void FlushSyncPointSignals(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Sends pending client to server signals right away, ahead of another server RPC */
+	void FlushPendingServerSyncSignals();
+
+	/** Invokes the generic replicated event for each received signal, in the order they were queued */
+	void ReceiveSyncPointSignals(EAbilityGenericReplicatedEvent::Type EventType, const TArray<FGSCNetSyncPointSignal>& Signals);
+
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerSetSyncPointSignals(const TArray<FGSCNetSyncPointSignal>& Signals);
+
+	UFUNCTION(Client, Reliable)
+	void ClientSetSyncPointSignals(const TArray<FGSCNetSyncPointSignal>& Signals);
 
 	/** Handler for AbilitySystem OnGiveAbility delegate. Sets up input binding for clients (not authority) when ability is granted and available for binding. */
-	virtual void HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, FGameplayAbilitySpec NewAbilitySpec);
+	virtual void HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, TSubclassOf<UGameplayAbility> AbilityClass);
 };
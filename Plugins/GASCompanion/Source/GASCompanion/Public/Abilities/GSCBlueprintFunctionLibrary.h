@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayEffectTypes.h"
+#include "Abilities/GSCTypes.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GSCBlueprintFunctionLibrary.generated.h"
 
@@ -125,4 +126,17 @@ public:
 	/** Removes any GameplayCue added on its own, i.e. not as part of a GameplayEffect. */
 	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Abilities|GameplayCue", meta=(GameplayTagFilter="GameplayCue"))
 	static void RemoveAllGameplayCues(AActor* Actor);
+
+	/**
+	 * Returns start time, total duration, expected end time, stack count and stack limit of an active gameplay effect.
+	 *
+	 * Same as calling each individual AbilitySystemBlueprintLibrary functions, but the active effect is resolved only once.
+	 *
+	 * @return Whether the active gameplay effect was found
+	 */
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Abilities|GameplayEffects")
+	static bool GetActiveGameplayEffectUIData(FActiveGameplayEffectHandle ActiveHandle, FGSCGameplayEffectUIData& OutEffectData);
+
+	/** Native version of GetActiveGameplayEffectUIData for an already resolved active gameplay effect */
+	static FGSCGameplayEffectUIData MakeGameplayEffectUIData(const FActiveGameplayEffect& ActiveGameplayEffect);
 };
@@ -8,8 +8,34 @@
 #include "Abilities/GameplayAbility.h"
 #include "GSCGameplayAbility.generated.h"
 
+class UGSCAbilityQueueComponent;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAbilityEnded);
 
+/** Effect specs built once by UGSCGameplayAbility for a given container and ability level, cloned for each application */
+USTRUCT()
+struct FGSCEffectContainerSpecTemplate
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag ContainerTag;
+
+	UPROPERTY()
+	int32 Level = 1;
+
+	/** Ability spec dynamic tags the specs were built with (captured as source spec tags) */
+	UPROPERTY()
+	FGameplayTagContainer DynamicAbilityTags;
+
+	/** Ability spec SetByCaller values the specs were built with */
+	UPROPERTY()
+	TMap<FGameplayTag, float> SetByCallerTagMagnitudes;
+
+	UPROPERTY()
+	TArray<FGameplayEffectSpec> Specs;
+};
+
 /**
  * GameplayAbility Parent class that is recommended to use with GAS Companion.
  *
@@ -59,6 +85,16 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayEffects)
     TMap<FGameplayTag, FGSCGameplayEffectContainer> EffectContainerMap;
 
+	/**
+	 * If true (and the ability is instanced), MakeEffectContainerSpec builds the effect specs of each container once per ability level,
+	 * and then only clones them, patching effect context and SetByCaller values, instead of building them from scratch for each application.
+	 *
+	 * Specs are rebuilt when the ability level, or the ability spec dynamic tags or SetByCaller values change. Anything else affecting
+	 * spec creation in a child class (eg. overridden MakeOutgoingGameplayEffectSpec) requires a call to InvalidateEffectContainerSpecCache.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = GameplayEffects, AdvancedDisplay)
+	bool bCacheEffectContainerSpecs = false;
+
     /** Make gameplay effect container spec to be applied later, using the passed in container */
     UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability", meta=(AutoCreateRefTerm = "EventData"))
     virtual FGSCGameplayEffectContainerSpec MakeEffectContainerSpecFromContainer(const FGSCGameplayEffectContainer& Container, const FGameplayEventData& EventData, int32 OverrideGameplayLevel = -1);
@@ -71,6 +107,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability")
     virtual TArray<FActiveGameplayEffectHandle> ApplyEffectContainerSpec(const FGSCGameplayEffectContainerSpec& ContainerSpec);
 
+    /**
+     * Applies a gameplay effect container spec that was previously created, to all of its targets in a single pass.
+     *
+     * Targets are resolved once for all the effect specs of the container, and each spec is copied once (instead of once per target).
+     * Returns a compact result with the number of targets and applications, and only the handles of non instant effects.
+     */
+    UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability")
+    virtual FGSCGameplayEffectContainerResult ApplyEffectContainerSpecBatched(const FGSCGameplayEffectContainerSpec& ContainerSpec);
+
+    /** Clears the effect container spec templates built by MakeEffectContainerSpec (see bCacheEffectContainerSpecs) */
+    UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability")
+    void InvalidateEffectContainerSpecCache();
+
     /** Applies a gameplay effect container, by creating and then applying the spec */
     UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability", meta = (AutoCreateRefTerm = "EventData"))
     virtual TArray<FActiveGameplayEffectHandle> ApplyEffectContainer(FGameplayTag ContainerTag, const FGameplayEventData& EventData, int32 OverrideGameplayLevel = -1);
@@ -106,7 +155,12 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "GAS Companion|Ability")
     FOnAbilityEnded OnAbilityEnded;
 
-	/** Called on ability end */
+	/**
+	 * Called on ability end.
+	 *
+	 * Invoked by UGSCAbilitySystemComponent::NotifyAbilityEnded (no per activation binding). For abilities
+	 * living on other ASC types, it is bound to OnGameplayAbilityEnded on each activation instead.
+	 */
 	void AbilityEnded(UGameplayAbility* Ability);
 
 protected:
@@ -120,11 +174,74 @@ protected:
 
 private:
 
+	/** Cached Ability Queue Component for the current avatar (resolved in OnAvatarSet, or lazily if the avatar changed) */
+	TWeakObjectPtr<UGSCAbilityQueueComponent> CachedAbilityQueueComponent;
+
+	/** Avatar CachedAbilityQueueComponent was resolved from */
+	TWeakObjectPtr<const AActor> CachedAbilityQueueAvatar;
+
+	/** Returns the Ability Queue Component of the current avatar, using the cached one if avatar didn't change */
+	UGSCAbilityQueueComponent* GetAbilityQueueComponent();
+
+	/** Cached effect container spec templates, one per container tag and ability level (a handful at most, searched linearly) */
+	UPROPERTY(Transient)
+	TArray<FGSCEffectContainerSpecTemplate> EffectContainerSpecTemplates;
+
+	/** Returns whether this ability can rely on EffectContainerSpecTemplates */
+	bool CanUseEffectContainerSpecCache() const;
+
+	/** Returns the cached template for this container tag and level, building it if needed */
+	const FGSCEffectContainerSpecTemplate& FindOrAddEffectContainerSpecTemplate(FGameplayTag ContainerTag, const FGSCGameplayEffectContainer& Container, int32 Level, const FGameplayAbilitySpec* AbilitySpec);
+
+	/** Runs the container target type (if any) and adds the resulting targets to the spec */
+	void AddEffectContainerTargets(const FGSCGameplayEffectContainer& Container, const FGameplayEventData& EventData, FGSCGameplayEffectContainerSpec& OutSpec);
+
+	/**
+	 * Batched application of a container spec. Used by both ApplyEffectContainerSpec and ApplyEffectContainerSpecBatched.
+	 *
+	 * If OutAllHandles is provided, it is filled with every handle returned by the target ASCs (including the ones for instant effects),
+	 * in the same order K2_ApplyGameplayEffectSpecToTarget would.
+	 */
+	void ApplyEffectContainerSpecInternal(const FGSCGameplayEffectContainerSpec& ContainerSpec, FGSCGameplayEffectContainerResult& OutResult, TArray<FActiveGameplayEffectHandle>* OutAllHandles);
+
+	/**
+	 * Additive modifier attributes of the cost gameplay effect, along with the attribute sets they resolve to on the last ASC checked.
+	 *
+	 * Only the attribute (and not the modifier magnitude) matters for the loose cost check, so this doesn't depend on the ability level.
+	 */
+	struct FCostAttributesCache
+	{
+		/** Cost GE the attributes were gathered from */
+		TWeakObjectPtr<const UGameplayEffect> CostGameplayEffect;
+
+		/** Attributes of the additive modifiers of the cost GE */
+		TArray<FGameplayAttribute> Attributes;
+
+		/** ASC the attribute sets were resolved on */
+		TWeakObjectPtr<const UAbilitySystemComponent> AbilitySystemComponent;
+
+		/** Number of spawned attributes on the ASC when resolving, to know when to resolve again for missing sets */
+		int32 NumSpawnedAttributes = INDEX_NONE;
+
+		/** Resolved attribute set for each entry in Attributes (null if the ASC doesn't have it) */
+		TArray<TWeakObjectPtr<const UAttributeSet>> AttributeSets;
+	};
+
+	/**
+	 * Cost attributes cache used by CheckForPositiveCost (mutable as CanActivateAbility is const).
+	 *
+	 * Only used by instanced abilities. Non instanced abilities run on the CDO, shared between every ASC, and resolve cost attributes on each check.
+	 */
+	mutable FCostAttributesCache CostAttributesCache;
+
 	/** Loosely Check for cost attribute current value to be positive */
 	bool CheckForPositiveCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags) const;
 
 	/** Does the actual check for attribute modifiers, only checking it their current value is <= 0 */
-	bool CanApplyPositiveAttributeModifiers(const UGameplayEffect *GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo, float Level, const FGameplayEffectContextHandle& EffectContext) const;
+	bool CanApplyPositiveAttributeModifiers(const UGameplayEffect *GameplayEffect, const FGameplayAbilityActorInfo* ActorInfo) const;
+
+	/** Updates Cache for the passed in cost GE and ASC, if needed */
+	static void UpdateCostAttributesCache(FCostAttributesCache& Cache, const UGameplayEffect* GameplayEffect, UAbilitySystemComponent* AbilitySystemComponent);
 
 	/** Returns spawned attribute set from passed in ASC based on provided AttributeClass (mainly because GetAttributeSuboject on AbilitySystemComponent is protected) */
     static const UAttributeSet* GetAttributeSubobjectForASC(UAbilitySystemComponent* AbilitySystemComponent, TSubclassOf<UAttributeSet> AttributeClass);
@@ -0,0 +1,102 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "GSCTargetDataTypes.generated.h"
+
+/**
+ * Target data holding any number of hit results, stored contiguously.
+ *
+ * Used by GSCGameplayEffectContainerSpec::AddTargets (when the container is configured to do so) in place of one
+ * SingleTargetHit target data per hit result, which is one allocation per hit.
+ *
+ * GetHitResult() only returns the first hit (the engine interface only deals with a single hit). Generic ApplyGameplayEffectSpec
+ * will thus only add the first hit to each target's effect context, while GSCGameplayAbility's batched application adds the
+ * matching hit result to each target's effect context.
+ */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCGameplayAbilityTargetData_MultiHit : public FGameplayAbilityTargetData
+{
+	GENERATED_BODY()
+
+	FGSCGameplayAbilityTargetData_MultiHit() {}
+
+	explicit FGSCGameplayAbilityTargetData_MultiHit(const TArray<FHitResult>& InHitResults)
+		: HitResults(InHitResults)
+	{
+	}
+
+	/** Max number of hit results that will be serialized over the network */
+	static constexpr int32 MaxNetSerializedHitResults = 255;
+
+	UPROPERTY()
+	TArray<FHitResult> HitResults;
+
+	//~ Begin FGameplayAbilityTargetData interface
+	virtual TArray<TWeakObjectPtr<AActor>> GetActors() const override;
+	virtual bool SetActors(TArray<TWeakObjectPtr<AActor>> NewActorArray) override;
+	virtual bool HasHitResult() const override;
+	virtual const FHitResult* GetHitResult() const override;
+	virtual bool HasOrigin() const override;
+	virtual FTransform GetOrigin() const override;
+	virtual bool HasEndPoint() const override;
+	virtual FVector GetEndPoint() const override;
+	virtual UScriptStruct* GetScriptStruct() const override;
+	virtual FString ToString() const override;
+	//~ End FGameplayAbilityTargetData interface
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGSCGameplayAbilityTargetData_MultiHit> : public TStructOpsTypeTraitsBase2<FGSCGameplayAbilityTargetData_MultiHit>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Pool of target data instances, to avoid a heap allocation per target data when building effect container specs.
+ *
+ * Instances are handed out as shared pointers (compatible with FGameplayAbilityTargetDataHandle shared ownership). The pool
+ * keeps its own reference to each instance, and an instance is reused as soon as the pool holds the last reference
+ * (eg. once the container spec and any copy of its target data handle are gone, typically by the next frame).
+ *
+ * Game thread only. Falls back to regular allocations once the pool is full or when called from another thread.
+ */
+class GASCOMPANION_API FGSCTargetDataPool
+{
+public:
+	static FGSCTargetDataPool& Get();
+
+	/** Returns a single target hit target data, initialized with the passed in hit result */
+	TSharedPtr<FGameplayAbilityTargetData_SingleTargetHit> AcquireSingleTargetHit(const FHitResult& HitResult);
+
+	/** Returns an actor array target data, initialized with the passed in actors */
+	TSharedPtr<FGameplayAbilityTargetData_ActorArray> AcquireActorArray(TArrayView<AActor* const> TargetActors);
+
+	/** Returns a multi hit target data, initialized with the passed in hit results */
+	TSharedPtr<FGSCGameplayAbilityTargetData_MultiHit> AcquireMultiHit(TArrayView<const FHitResult> HitResults);
+
+	/** Releases all pooled instances not currently in use. Called on world cleanup by GAS Companion module. */
+	void Trim();
+
+private:
+	template<typename TargetDataType>
+	struct TPool
+	{
+		TArray<TSharedPtr<TargetDataType>> Entries;
+		int32 Cursor = 0;
+
+		TSharedPtr<TargetDataType> Acquire();
+		void Trim();
+	};
+
+	TPool<FGameplayAbilityTargetData_SingleTargetHit> SingleTargetHitPool;
+	TPool<FGameplayAbilityTargetData_ActorArray> ActorArrayPool;
+	TPool<FGSCGameplayAbilityTargetData_MultiHit> MultiHitPool;
+};
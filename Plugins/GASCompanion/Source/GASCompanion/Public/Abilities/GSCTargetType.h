@@ -6,6 +6,10 @@
 #include "Abilities/GameplayAbilityTypes.h"
 #include "GSCTargetType.generated.h"
 
+/** Targeting buffers used by GetTargetsNative, inline allocated for the common case of a few targets */
+using FGSCTargetHitResults = TArray<FHitResult, TInlineAllocator<4>>;
+using FGSCTargetActors = TArray<AActor*, TInlineAllocator<8>>;
+
 /**
 * Class that is used to determine targeting for abilities
 *
@@ -28,4 +32,22 @@ class GASCOMPANION_API UGSCTargetType : public UObject
 	/** Called to determine targets to apply gameplay effects to */
 	UFUNCTION(BlueprintNativeEvent)
     void GetTargets(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const;
+
+	/**
+	 * Native targeting entry point, used by GSCGameplayAbility when building effect container specs.
+	 *
+	 * Takes the event by const reference and appends to the passed in buffers (they are not reset). Native target types should
+	 * override this one. The default implementation falls back to the Blueprint GetTargets event, which requires a copy of the event data.
+	 */
+	virtual void GetTargetsNative(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const;
+
+	/**
+	 * Gathers targets through GetTargetsNative, unless GetTargets is overridden in Blueprint (eg. a Blueprint child of a native
+	 * target type), in which case the Blueprint event is called so that the override is honored.
+	 */
+	void GatherTargets(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const;
+
+private:
+	/** Returns whether GetTargets is implemented by a Blueprint class in this object hierarchy */
+	bool HasBlueprintGetTargets() const;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbilityTargetTypes.h"
+#include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
 #include "GSCTypes.generated.h"
 
@@ -27,6 +28,20 @@ enum class EGSCAbilityTriggerEvent : uint8
 	Triggered UMETA(DisplayName="Activate on Action Triggered (use with caution)"),
 };
 
+/** Ability System Component profile, trading GAS Companion features for lower per actor cost */
+UENUM(BlueprintType)
+enum class EGSCAbilitySystemProfile : uint8
+{
+	/** Every GAS Companion feature (input binding, ability queue, UI and controller change notifications), with the configured replication mode. */
+	Full,
+
+	/**
+	 * Lightweight profile for AI crowds. Skips input binding and ability queue plumbing, controller change and UI notifications,
+	 * and forces Minimal replication mode. Not meant for player controlled actors nor ASC living on Player States.
+	 */
+	Crowd,
+};
+
 /**
 * Struct defining a list of gameplay effects, a tag, and targeting info
 *
@@ -56,6 +71,14 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = GameplayEffectContainer)
 	float SetByCallerMagnitude = 1.0f;
+
+	/**
+	 * If true, all hit results returned by the Target Type are stored in a single target data (instead of one target data per hit result).
+	 *
+	 * Cheaper for abilities hitting many targets, but Blueprints iterating the target data handle will only see one entry for all hits.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = GameplayEffectContainer, AdvancedDisplay)
+	bool bUseMultiHitTargetData = false;
 };
 
 /** A "processed" version of GSCGameplayEffectContainer that can be passed around and eventually applied */
@@ -81,6 +104,72 @@ public:
 	/** Returns true if this has any valid targets */
 	bool HasValidTargets() const;
 
-	/** Adds new targets to target data */
-	void AddTargets(const TArray<FHitResult>& HitResults, const TArray<AActor*>& TargetActors);
+	/**
+	 * Adds new targets to target data
+	 *
+	 * Target data instances are taken from FGSCTargetDataPool. If bUseMultiHitTargetData is true, hit results are stored
+	 * in a single FGSCGameplayAbilityTargetData_MultiHit instead of one SingleTargetHit per hit result.
+	 */
+	void AddTargets(TArrayView<const FHitResult> HitResults, TArrayView<AActor* const> TargetActors, bool bUseMultiHitTargetData = false);
+};
+
+/** Compact result of applying a gameplay effect container spec with GSCGameplayAbility::ApplyEffectContainerSpecBatched */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCGameplayEffectContainerResult
+{
+	GENERATED_BODY()
+
+public:
+	FGSCGameplayEffectContainerResult() {}
+
+	/** Number of targets (with an Ability System Component) the effects were applied to */
+	UPROPERTY(BlueprintReadOnly, Category = GameplayEffectContainer)
+	int32 NumTargets = 0;
+
+	/** Number of effect applications that went through (instant executions included) */
+	UPROPERTY(BlueprintReadOnly, Category = GameplayEffectContainer)
+	int32 NumApplied = 0;
+
+	/** Number of effect applications that were blocked by the target (immunity, application requirements, ...) */
+	UPROPERTY(BlueprintReadOnly, Category = GameplayEffectContainer)
+	int32 NumBlocked = 0;
+
+	/** Handles of the applied non instant effects. Instant effects don't leave an active effect behind and are only counted in NumApplied. */
+	UPROPERTY(BlueprintReadOnly, Category = GameplayEffectContainer)
+	TArray<FActiveGameplayEffectHandle> ActiveHandles;
+};
+
+/** Timing and stacking information of an active gameplay effect, as passed down to user widgets */
+USTRUCT(BlueprintType)
+struct FGSCGameplayEffectUIData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
+	float StartTime;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
+	float TotalDuration;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
+	float ExpectedEndTime;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
+	int32 StackCount;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
+	int32 StackLimitCount;
+
+	FGSCGameplayEffectUIData(const float StartTime, const float TotalDuration, const float ExpectedEndTime, const int32 StackCount, const int32 StackLimitCount)
+		: StartTime(StartTime),
+		  TotalDuration(TotalDuration),
+		  ExpectedEndTime(ExpectedEndTime),
+		  StackCount(StackCount),
+		  StackLimitCount(StackLimitCount)
+	{
+	}
+
+	FGSCGameplayEffectUIData(): StartTime(0), TotalDuration(0), ExpectedEndTime(0), StackCount(0), StackLimitCount(0)
+	{
+	}
 };
@@ -17,4 +17,5 @@ public:
 
     /** Uses the passed in event data */
     virtual void GetTargets_Implementation(AActor* TargetingActor, FGameplayEventData EventData, TArray<FHitResult>& OutHitResults, TArray<AActor*>& OutActors) const override;
+    virtual void GetTargetsNative(AActor* TargetingActor, const FGameplayEventData& EventData, FGSCTargetHitResults& OutHitResults, FGSCTargetActors& OutActors) const override;
 };
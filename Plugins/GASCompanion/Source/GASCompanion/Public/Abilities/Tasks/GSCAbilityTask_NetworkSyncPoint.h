@@ -60,6 +60,9 @@ protected:
 
 	void SyncFinished();
 
+	/** Signal the remote end, through the owner UGSCAbilitySystemComponent sync channel if available, or a generic replicated event RPC */
+	void SendSignal(EAbilityGenericReplicatedEvent::Type EventType) const;
+
 	/** The event we replicate */
 	EAbilityGenericReplicatedEvent::Type ReplicatedEventToListenFor;
 
@@ -76,6 +76,7 @@ public:
 	* @param StartSection Change to montage section to play during montage
 	* @param bStopWhenAbilityEnds If true, this montage will be aborted if the ability ends normally. It is always stopped when the ability is explicitly cancelled
 	* @param AnimRootMotionTranslationScale Change to modify size of root motion or set to 0 to block it entirely
+	* @param bCoalesceServerSync If true, events received by the client in the same prediction window share a single batch signal (and RPC) instead of one sync point task each. The server dispatches its own events in order, as batches are confirmed. Requires a UGSCAbilitySystemComponent, and a single coalescing task per ability at a time
 	*/
 	UFUNCTION(BlueprintCallable, Category= "Ability|GAS Companion|Tasks", meta = (HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "TRUE"))
     static UGSCTask_PlayMontageWaitForEvent* PlayMontageAndWaitForEvent(
@@ -86,7 +87,8 @@ public:
         float Rate = 1.f,
         FName StartSection = NAME_None,
         bool bStopWhenAbilityEnds = true,
-        float AnimRootMotionTranslationScale = 1.f);
+        float AnimRootMotionTranslationScale = 1.f,
+        bool bCoalesceServerSync = false);
 
 private:
 	/** Montage that is playing */
@@ -113,17 +115,46 @@ private:
 	UPROPERTY()
 	bool bStopWhenAbilityEnds = true;
 
+	/** Rather gameplay events should be batched behind a single server sync signal per prediction window */
+	UPROPERTY()
+	bool bCoalesceServerSync = false;
+
+	/** Server only, events waiting for the client batch signal, in the order they were received (EventTag is set on each entry) */
+	TArray<FGameplayEventData> PendingSyncEvents;
+
+	/** Server only, number of events confirmed by client batch signals and not dispatched yet */
+	int32 NumConfirmedSyncEvents = 0;
+
+	/** Number of gameplay events received by this task */
+	int32 NumEventsReceived = 0;
+
+	/** Number of sync point tasks created by this task (one replicated event each) */
+	int32 NumSyncTasksCreated = 0;
+
+	/** Number of batch signals sent by this task, when coalescing server sync */
+	int32 NumSyncBatchesSent = 0;
+
 	/** Checks if the ability is playing a montage and stops that montage, returns true if a montage was stopped, false if not. */
 	bool StopPlayingMontage() const;
 
 	void OnMontageBlendingOut(UAnimMontage* Montage, bool bInterrupted) const;
 	void OnAbilityCancelled() const;
 	void OnMontageEnded(UAnimMontage* Montage, bool bInterrupted);
-	void OnGameplayEvent(FGameplayTag EventTag, const FGameplayEventData* Payload) const;
+	void OnGameplayEvent(FGameplayTag EventTag, const FGameplayEventData* Payload);
 	void OnServerSyncEventReceived(FGameplayTag EventTag, FGameplayEventData EventData) const;
 
+	/** Handles an event with coalesced server sync, returns false if it should go through its own sync point instead */
+	bool HandleCoalescedEvent(const FGameplayEventData& EventData);
+
+	/** Server only, counts the events released by a client batch signal for this ability and dispatches them */
+	void OnSyncEventBatchReceived(FGameplayAbilitySpecHandle AbilityHandle, FPredictionKey AbilityOriginalPredictionKey, int32 NumEvents);
+
+	/** Server only, broadcasts EventReceived for every pending event confirmed by the client, in order */
+	void DispatchConfirmedSyncEvents();
+
 	FOnMontageBlendingOutStarted BlendingOutDelegate;
 	FOnMontageEnded MontageEndedDelegate;
 	FDelegateHandle CancelledHandle;
 	FDelegateHandle EventHandle;
+	FDelegateHandle SyncEventBatchHandle;
 };
@@ -73,6 +73,10 @@ public:
 	virtual void ReleaseInputComponent(AController* OldController) override;
 	//~ End UPlayerControlsComponent interface
 
+	//~ Begin UActorComponent interface
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End UActorComponent interface
+
 	/**
 	 * Updates the Ability Input Binding Component registered bindings or create a new one for the passed in Ability Handle.
 	 *
@@ -131,5 +135,11 @@ private:
 	FGameplayAbilitySpec* FindAbilitySpec(FGameplayAbilitySpecHandle Handle) const;
 	void TryBindAbilityInput(UInputAction* InputAction, FGSCAbilityInputBinding& AbilityInputBinding);
 
+	/** Acquires a new Input ID from this world's UGSCInputIDSubsystem */
+	int32 AcquireInputID() const;
+
+	/** Gives back a previously acquired Input ID to this world's UGSCInputIDSubsystem so that it can be recycled */
+	void ReleaseInputID(int32 InputID) const;
+
 	static ETriggerEvent GetInputActionTriggerEvent(EGSCAbilityTriggerEvent TriggerEvent);
 };
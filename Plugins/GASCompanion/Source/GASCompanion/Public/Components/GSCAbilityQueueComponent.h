@@ -35,6 +35,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System")
 	bool bAbilityQueueEnabled = true;
 
+	/** Enables or disables the ability queue system, and notify debug widget if any is on screen */
+	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Ability Queue System")
+	void SetAbilityQueueEnabled(bool bEnabled);
+
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
 
@@ -103,4 +107,9 @@ protected:
 	* Notify Debug Ability Queue Widget by updating its allowed abilities
 	*/
 	virtual void UpdateDebugWidgetAllowedAbilities();
+
+	/**
+	* Notify Debug Ability Queue Widget that queue state (enabled, opened, queued ability, allow all) changed
+	*/
+	virtual void UpdateDebugWidgetQueueState();
 };
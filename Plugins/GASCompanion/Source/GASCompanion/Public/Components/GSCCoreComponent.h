@@ -97,6 +97,9 @@ public:
 	/** Clean up any bound delegates to Ability System delegates */
 	void ShutdownAbilitySystemDelegates(UAbilitySystemComponent* ASC);
 
+	/** Returns memory allocated to keep track of bound Ability System delegates (effect handles and tags). Used by GASCompanion.Memory.Report */
+	SIZE_T GetAllocatedSize() const;
+
 	// Called from AttributeSet, and trigger BP events
 	virtual void HandleDamage(float DamageAmount, const FGameplayTagContainer& DamageTags, AActor* SourceActor);
 	virtual void HandleHealthChange(float DeltaValue, const FGameplayTagContainer& EventTags);
@@ -0,0 +1,147 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayPrediction.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+#ifndef GSC_WITH_INPUT_LATENCY_TRACKING
+	#define GSC_WITH_INPUT_LATENCY_TRACKING !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * Fixed bucket histogram of latencies, in milliseconds.
+ */
+struct GASCOMPANION_API FGSCLatencyHistogram
+{
+	/** Upper bound (inclusive) of each bucket, in ms. Last bucket catches everything above. */
+	static constexpr int32 NumBuckets = 14;
+	static const float BucketUpperBoundsMs[NumBuckets - 1];
+
+	int32 Buckets[NumBuckets] = {};
+	int32 Count = 0;
+	double SumMs = 0.0;
+	double MinMs = 0.0;
+	double MaxMs = 0.0;
+
+	void AddSample(double LatencyMs);
+	double GetAverageMs() const;
+
+	/** Approximated percentile (0-1), returns the upper bound of the bucket the percentile falls in */
+	double GetPercentileMs(float Percentile) const;
+};
+
+/** Latency categories tracked for each ability class */
+enum class EGSCInputLatencyCategory : uint8
+{
+	/** Press to ActivateAbility, with authority (standalone or listen server host) */
+	Local,
+	/** Press to locally predicted ActivateAbility (clients) */
+	Predicted,
+	/** Press to server confirmation of the activation (prediction key caught up, or server initiated activation) */
+	ServerConfirmed,
+
+	MAX
+};
+
+/**
+ * Collects timestamped lifecycle markers for ability input presses (Enhanced Input trigger, ASC dispatch, combo routing / ability queue,
+ * activation and server confirmation), and aggregates them into per ability latency histograms.
+ *
+ * Disabled by default, turn it on with `GASCompanion.Latency.Enabled 1`. Results are available via `GASCompanion.Latency.Dump`
+ * and `GASCompanion.Latency.ExportCSV`.
+ *
+ * Game thread only.
+ */
+class GASCOMPANION_API FGSCInputLatencyTracker
+{
+public:
+	static FGSCInputLatencyTracker& Get();
+
+	/** Returns whether tracking is enabled (GASCompanion.Latency.Enabled cvar) */
+	static bool IsEnabled();
+
+	/** Called when Enhanced Input triggers the pressed event of an ability input action */
+	void MarkInputPressed(const UAbilitySystemComponent* AbilitySystemComponent, int32 InputID);
+
+	/** Called when the ASC routes the press to an ability spec, either directly or via the combo component */
+	void MarkInputDispatched(const UAbilitySystemComponent* AbilitySystemComponent, int32 InputID, const UGameplayAbility* Ability, bool bRoutedToCombo);
+
+	/** Called when an ability is activated (predicted or authority) */
+	void MarkAbilityActivated(const UAbilitySystemComponent* AbilitySystemComponent, const UGameplayAbility* Ability);
+
+	/** Called when an ability failed to activate. The press is kept around as the ability might be queued. */
+	void MarkAbilityFailed(const UAbilitySystemComponent* AbilitySystemComponent, const UGameplayAbility* Ability);
+
+	/** Clears all recorded data */
+	void Reset();
+
+	/** Prints per ability summary to the output device */
+	void Dump(FOutputDevice& Ar) const;
+
+	/** Writes per ability summary (and recently completed presses) as CSV. Returns false if files couldn't be written. */
+	bool ExportCSV(const FString& Filename) const;
+
+private:
+	/** A single press, with lifecycle timestamps (FPlatformTime::Seconds()) */
+	struct FPressRecord
+	{
+		TWeakObjectPtr<const UAbilitySystemComponent> AbilitySystemComponent;
+		int32 InputID = INDEX_NONE;
+		FName AbilityName;
+		double PressedTime = 0.0;
+		double DispatchedTime = 0.0;
+		double FailedTime = 0.0;
+		double ActivatedTime = 0.0;
+		double ConfirmedTime = 0.0;
+		bool bRoutedToCombo = false;
+		bool bPredicted = false;
+	};
+
+	struct FAbilityLatencyStats
+	{
+		FGSCLatencyHistogram Histograms[static_cast<int32>(EGSCInputLatencyCategory::MAX)];
+		int32 NumFailed = 0;
+		int32 NumRejected = 0;
+		int32 NumExpired = 0;
+	};
+
+	/** Presses waiting for activation */
+	TArray<FPressRecord> PendingPresses;
+
+	/** Presses waiting for server confirmation, keyed by prediction key. Expired if the server never catches up with nor rejects the key. */
+	TMap<FPredictionKey::KeyType, FPressRecord> AwaitingConfirmation;
+
+	/** Ring buffer of the last completed presses */
+	TArray<FPressRecord> CompletedPresses;
+	int32 CompletedPressesHead = 0;
+
+	TMap<FName, FAbilityLatencyStats> Stats;
+
+	/** Drops presses waiting for activation or server confirmation for too long, counting them as expired */
+	void ExpirePendingPresses(double Now);
+	void AddCompletedPress(const FPressRecord& Record);
+	void OnPredictionKeyCaughtUp(FPredictionKey::KeyType PredictionKey);
+	void OnPredictionKeyRejected(FPredictionKey::KeyType PredictionKey);
+
+	/** Prediction key delegates are bound to these (static) handlers, forwarding to the singleton, so that they never reference a dead tracker */
+	static void HandlePredictionKeyCaughtUp(FPredictionKey::KeyType PredictionKey);
+	static void HandlePredictionKeyRejected(FPredictionKey::KeyType PredictionKey);
+
+	static const TCHAR* GetCategoryName(EGSCInputLatencyCategory Category);
+};
+
+#if GSC_WITH_INPUT_LATENCY_TRACKING
+	#define GSC_INPUT_LATENCY_MARK(Marker, ...) \
+	{ \
+		if (FGSCInputLatencyTracker::IsEnabled()) \
+		{ \
+			FGSCInputLatencyTracker::Get().Marker(__VA_ARGS__); \
+		} \
+	}
+#else
+	#define GSC_INPUT_LATENCY_MARK(Marker, ...)
+#endif
@@ -0,0 +1,52 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UAbilitySystemComponent;
+struct FGameplayAbilitySpec;
+
+/** Bytes attributed to an actor Ability System, split by category */
+struct GASCOMPANION_API FGSCMemoryFootprint
+{
+	/** Spawned attribute sets */
+	SIZE_T AttributeSets = 0;
+
+	/** Activatable ability specs and ability instances */
+	SIZE_T Abilities = 0;
+
+	/** Active gameplay effects */
+	SIZE_T Effects = 0;
+
+	/** GAS Companion bookkeeping on ASC and Core Component (mapped abilities, delegate bindings, effect handle registries) */
+	SIZE_T Bookkeeping = 0;
+
+	/** Game Feature action extensions tracked for the actor */
+	SIZE_T GameFeatures = 0;
+
+	SIZE_T GetTotal() const { return AttributeSets + Abilities + Effects + Bookkeeping + GameFeatures; }
+
+	FGSCMemoryFootprint& operator+=(const FGSCMemoryFootprint& Other);
+};
+
+/**
+ * Per actor / per class memory report of Ability System related allocations, used to size servers and catch leaks
+ * in long sessions.
+ *
+ * Available via `GASCompanion.Memory.Report [ClassFilter]`. Counts are estimates: UObjects are measured with
+ * FArchiveCountMem, containers with their allocated size.
+ */
+class GASCOMPANION_API FGSCMemoryReport
+{
+public:
+	/** Returns memory footprint of the passed in Ability System Component, owner actor Game Feature extensions included */
+	static FGSCMemoryFootprint GetFootprint(const UAbilitySystemComponent* AbilitySystemComponent);
+
+	/** Returns heap memory owned by an ability spec (dynamic tags and instances arrays) */
+	static SIZE_T GetAllocatedSize(const FGameplayAbilitySpec& AbilitySpec);
+
+	/** Prints footprint of every Ability System in World, per actor and per actor class, optionally filtered by actor class name */
+	static void Dump(const UWorld* World, FOutputDevice& Ar, const FString& ClassFilter = FString());
+};
@@ -0,0 +1,65 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayPrediction.h"
+#include "Trace/Trace.h"
+
+#ifndef GSC_WITH_TRACE
+#define GSC_WITH_TRACE (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+/** Lifecycle events emitted on the GASCompanion trace channel */
+enum class EGSCTraceEventType : uint8
+{
+	AbilityGranted,
+	AbilityActivated,
+	AbilityCommitted,
+	AbilityEnded,
+	AbilityFailed,
+	EffectAdded,
+	EffectStackChanged,
+	EffectRemoved,
+	ComboIndexChanged,
+	AbilityQueueOpened,
+	AbilityQueueClosed,
+	AbilityQueueConsumed,
+	GameFeatureAbilitiesGranted,
+};
+
+GASCOMPANION_API const TCHAR* LexToString(EGSCTraceEventType EventType);
+
+#if GSC_WITH_TRACE
+
+UE_TRACE_CHANNEL_EXTERN(GASCompanionChannel, GASCOMPANION_API);
+
+/**
+ * Unreal Insights integration.
+ *
+ * Start a trace with the GASCompanion channel enabled (eg. `-trace=cpu,frame,bookmark,gascompanion` or `Trace.Enable GASCompanion`)
+ * to record a GASCompanion.Event for each ability / effect / combo / queue / game feature event, with the owning actor,
+ * the ability or effect class, prediction key and an event specific value (stack count, combo index, number of abilities).
+ *
+ * Each event is also output as a bookmark so that it shows up in the Timing view, next to CPU tracks.
+ */
+struct GASCOMPANION_API FGSCTrace
+{
+	/** Outputs a trace event. Subject can be an ability / effect instance or class, its class name is recorded. */
+	static void OutputEvent(EGSCTraceEventType EventType, const AActor* Actor, const UObject* Subject, const FPredictionKey& PredictionKey, int32 Value);
+};
+
+/** Emits a GASCompanion trace event. Arguments are not evaluated unless the channel is enabled. */
+#define GSC_TRACE_EVENT(EventType, Actor, Subject, PredictionKey, Value) \
+{ \
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(GASCompanionChannel)) \
+	{ \
+		FGSCTrace::OutputEvent(EGSCTraceEventType::EventType, Actor, Subject, PredictionKey, Value); \
+	} \
+}
+
+#else
+
+#define GSC_TRACE_EVENT(EventType, Actor, Subject, PredictionKey, Value)
+
+#endif
@@ -50,4 +50,24 @@ public:
 	 */
 	UPROPERTY(Config, EditAnywhere, Category = "Ability System", meta=(DisplayName = "Prevent Ability System Global Data Initialization in Startup Module (Recommended)"))
 	bool bPreventGlobalDataInitialization = false;
+
+	/** World space user widgets (bUseSharedUpdateScheduler) within this distance to the local viewer are updated every frame */
+	UPROPERTY(Config, EditAnywhere, Category = "User Widgets", meta=(ClampMin = "0.0", ForceUnits = "cm"))
+	float WidgetUpdateNearDistance = 1500.f;
+
+	/** World space user widgets further away than this distance are updated every WidgetUpdateFarInterval seconds */
+	UPROPERTY(Config, EditAnywhere, Category = "User Widgets", meta=(ClampMin = "0.0", ForceUnits = "cm"))
+	float WidgetUpdateFarDistance = 5000.f;
+
+	/** Update interval for world space user widgets between near and far distance */
+	UPROPERTY(Config, EditAnywhere, Category = "User Widgets", meta=(ClampMin = "0.0", ForceUnits = "s"))
+	float WidgetUpdateMidInterval = 0.1f;
+
+	/** Update interval for world space user widgets beyond far distance */
+	UPROPERTY(Config, EditAnywhere, Category = "User Widgets", meta=(ClampMin = "0.0", ForceUnits = "s"))
+	float WidgetUpdateFarInterval = 0.5f;
+
+	/** Update interval for world space user widgets that are hidden, or whose owner wasn't rendered recently */
+	UPROPERTY(Config, EditAnywhere, Category = "User Widgets", meta=(ClampMin = "0.0", ForceUnits = "s"))
+	float WidgetUpdateHiddenInterval = 1.f;
 };
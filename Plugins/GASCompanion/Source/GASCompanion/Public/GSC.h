@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class UWorld;
+
 class FGSCModule : public IModuleInterface
 {
 public:
@@ -22,4 +24,7 @@ protected:
 	void UpdateAssetManagerClass();
 	
 	void OnPostEngineInit();
+
+	/** Releases pooled target data (FGSCTargetDataPool) no longer in use, once a world is torn down */
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
 };
@@ -4,16 +4,26 @@
 
 #include "CoreMinimal.h"
 
+class UAbilitySystemComponent;
+class UGSCAbilityQueueComponent;
 class UGameplayAbility;
 
 struct GASCOMPANION_API FGSCDelegates
 {
 	DECLARE_MULTICAST_DELEGATE_OneParam(FGSCDebugWidgetAnimMontage, UAnimSequenceBase*);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FGSCDebugWidgetUpdateAllowedAbilities, TArray<TSubclassOf<UGameplayAbility>>);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FGSCDebugWidgetAbilityQueueState, const UGSCAbilityQueueComponent*);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnAbilityActorInfoInitialized, UAbilitySystemComponent*);
 
 	/** Called to notify ability queue debug widget about montage infos. */
 	static FGSCDebugWidgetAnimMontage OnAddAbilityQueueFromMontageRow;
 
 	/** Called to notify ability queue debug widget about allowed abilities. */
 	static FGSCDebugWidgetUpdateAllowedAbilities OnUpdateAllowedAbilities;
+
+	/** Called to notify ability queue debug widget that the state of an ability queue component changed. */
+	static FGSCDebugWidgetAbilityQueueState OnAbilityQueueStateChanged;
+
+	/** Called whenever a GAS Companion Ability System Component is done with InitAbilityActorInfo (abilities and attributes granted). */
+	static FGSCOnAbilityActorInfoInitialized OnAbilityActorInfoInitialized;
 };
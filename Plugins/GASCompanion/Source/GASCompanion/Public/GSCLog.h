@@ -9,8 +9,24 @@
 //	Verbose - This is why this happened. What you may turn on to debug the ability system code.
 //
 
-GASCOMPANION_API DECLARE_LOG_CATEGORY_EXTERN(LogAbilitySystemCompanion, Display, All);
-GASCOMPANION_API DECLARE_LOG_CATEGORY_EXTERN(LogAbilitySystemCompanionUI, Display, All);
+// Compile-time max verbosity of GAS Companion log categories, per build configuration.
+//
+// Anything more verbose is compiled out entirely, arguments included (no GetName() / ToString() allocations in hot paths).
+// Below that level, UE_LOG only evaluates arguments once the runtime verbosity check passed.
+//
+// Can be overridden from a Target.cs, eg. GlobalDefinitions.Add("GSC_LOG_COMPILETIME_VERBOSITY=Warning");
+#ifndef GSC_LOG_COMPILETIME_VERBOSITY
+	#if UE_BUILD_SHIPPING || (UE_SERVER && !WITH_EDITOR)
+		#define GSC_LOG_COMPILETIME_VERBOSITY Display
+	#elif UE_BUILD_TEST
+		#define GSC_LOG_COMPILETIME_VERBOSITY Log
+	#else
+		#define GSC_LOG_COMPILETIME_VERBOSITY All
+	#endif
+#endif
+
+GASCOMPANION_API DECLARE_LOG_CATEGORY_EXTERN(LogAbilitySystemCompanion, Display, GSC_LOG_COMPILETIME_VERBOSITY);
+GASCOMPANION_API DECLARE_LOG_CATEGORY_EXTERN(LogAbilitySystemCompanionUI, Display, GSC_LOG_COMPILETIME_VERBOSITY);
 
 class FGSCScreenLogger
 {
@@ -36,6 +52,9 @@ public:
 	}
 };
 
+// Whether a GSC_LOG at this verbosity would be output. Use it to guard any string built ahead of a GSC_LOG call.
+#define GSC_LOG_ACTIVE(Verbosity) UE_LOG_ACTIVE(LogAbilitySystemCompanion, Verbosity)
+
 #define GSC_LOG(Verbosity, Format, ...) \
 { \
     UE_LOG(LogAbilitySystemCompanion, Verbosity, Format, ##__VA_ARGS__); \
@@ -48,6 +67,9 @@ public:
 
 #define GSC_SLOG(Verbosity, Format, ...) \
 { \
-	FGSCScreenLogger::AddOnScreenDebugMessage(ELogVerbosity::Verbosity, FString::Printf(Format, ##__VA_ARGS__)); \
+	if (GSC_LOG_ACTIVE(Verbosity)) \
+	{ \
+		FGSCScreenLogger::AddOnScreenDebugMessage(ELogVerbosity::Verbosity, FString::Printf(Format, ##__VA_ARGS__)); \
+	} \
 	UE_LOG(LogAbilitySystemCompanion, Verbosity, Format, ##__VA_ARGS__); \
 }
@@ -0,0 +1,57 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+// Runtime stats for GAS Companion hot paths.
+//
+// Viewable in game with `stat GASCompanion`, and recorded in the "GASCompanion" category of CSV profiles
+// (csvprofile start / stop). Both compile out when stats / CSV profiler are disabled (eg. Shipping).
+
+DECLARE_STATS_GROUP(TEXT("GASCompanion"), STATGROUP_GASCompanion, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(GASCOMPANION_API, GASCompanion);
+
+// Cycle counters
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ASC AbilityLocalInputPressed"), STAT_GSC_AbilityLocalInputPressed, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ASC GrantDefaultAbilitiesAndAttributes"), STAT_GSC_GrantDefaultAbilitiesAndAttributes, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ASC RestoreSnapshot"), STAT_GSC_RestoreSnapshot, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AttributeSet PostGameplayEffectExecute"), STAT_GSC_PostGameplayEffectExecute, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CoreComponent Broadcast"), STAT_GSC_CoreComponentBroadcast, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GameFeature AddActorAbilities"), STAT_GSC_GameFeatureAddActorAbilities, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GameFeature RemoveActorAbilities"), STAT_GSC_GameFeatureRemoveActorAbilities, STATGROUP_GASCompanion, GASCOMPANION_API);
+
+// Event counters (reset every frame)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ability Activations"), STAT_GSC_NumAbilityActivations, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ability Activation Failures"), STAT_GSC_NumAbilityFailures, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ability Ends"), STAT_GSC_NumAbilityEnds, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effect Executions"), STAT_GSC_NumEffectExecutions, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("CoreComponent Delegate Broadcasts"), STAT_GSC_NumDelegateBroadcasts, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("GameFeature Abilities Granted"), STAT_GSC_NumGameFeatureAbilitiesGranted, STATGROUP_GASCompanion, GASCOMPANION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PlayerState Forced Net Updates"), STAT_GSC_NumForcedNetUpdates, STATGROUP_GASCompanion, GASCOMPANION_API);
+
+/** Scoped cycle counter, also recorded as a CSV profiler timing stat */
+#define GSC_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	CSV_SCOPED_TIMING_STAT(GASCompanion, Stat)
+
+/** Increments an event counter, also accumulated in the CSV profiler */
+#define GSC_INC_COUNTER(Stat) \
+	INC_DWORD_STAT(Stat); \
+	CSV_CUSTOM_STAT(GASCompanion, Stat, 1, ECsvCustomStatOp::Accumulate)
+
+// Low Level Memory Tracker tags (run with -llm, then `stat LLMFULL` or -llmcsv).
+//
+// Allocations made within LLM_SCOPE_BYTAG(GASCompanion_*) scopes are attributed to GASCompanion/Abilities,
+// GASCompanion/Attributes, GASCompanion/GameFeatures and GASCompanion/UI, all children of GASCompanion.
+// Compiles out when LLM is disabled. See also `GASCompanion.Memory.Report` for per actor byte counts.
+
+LLM_DECLARE_TAG_API(GASCompanion, GASCOMPANION_API);
+LLM_DECLARE_TAG_API(GASCompanion_Abilities, GASCOMPANION_API);
+LLM_DECLARE_TAG_API(GASCompanion_Attributes, GASCOMPANION_API);
+LLM_DECLARE_TAG_API(GASCompanion_GameFeatures, GASCOMPANION_API);
+LLM_DECLARE_TAG_API(GASCompanion_UI, GASCOMPANION_API);
@@ -114,6 +114,9 @@ public:
 	void AddActorAbilities(AActor* Actor, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry);
 	void RemoveActorAbilities(const AActor* Actor);
 
+	/** Returns memory allocated to keep track of abilities, attributes and effects granted to Actor. Used by GASCompanion.Memory.Report */
+	SIZE_T GetAllocatedSize(const AActor* Actor) const;
+
 	template<class ComponentType>
 	ComponentType* FindOrAddComponentForActor(AActor* Actor, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry)
 	{
@@ -140,13 +143,13 @@ private:
 	virtual void AddToWorld(const FWorldContext& WorldContext);
 	void HandleGameInstanceStart(UGameInstance* GameInstance);
 
-	static void TryGrantAbility(UGSCAbilitySystemComponent* AbilitySystemComponent, TSubclassOf<UGameplayAbility> AbilityType, OUT FGameplayAbilitySpecHandle& AbilityHandle, OUT FGameplayAbilitySpec& AbilitySpec);
-	void TryBindAbilityInput(UGSCAbilitySystemComponent* AbilitySystemComponent, const FGSCGameFeatureAbilityMapping& AbilityMapping, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry, FGameplayAbilitySpecHandle AbilityHandle, FGameplayAbilitySpec AbilitySpec, OUT FActorExtensions& AddedExtensions);
+	void TryGrantAbility(UGSCAbilitySystemComponent* AbilitySystemComponent, TSubclassOf<UGameplayAbility> AbilityType, OUT FGameplayAbilitySpecHandle& AbilityHandle, OUT FGameplayAbilitySpec& AbilitySpec);
+	void TryBindAbilityInput(UGSCAbilitySystemComponent* AbilitySystemComponent, const FGSCGameFeatureAbilityMapping& AbilityMapping, const FGSCGameFeatureAbilitiesEntry& AbilitiesEntry, FGameplayAbilitySpecHandle AbilityHandle, const FGameplayAbilitySpec& AbilitySpec, OUT FActorExtensions& AddedExtensions);
 	static void TryGrantAttributes(UAbilitySystemComponent* AbilitySystemComponent, const FGSCGameFeatureAttributeSetMapping& AttributeSetMapping, OUT FActorExtensions& AddedExtensions);
-	static void TryGrantGameplayEffect(UAbilitySystemComponent* AbilitySystemComponent, TSubclassOf<UGameplayEffect> EffectType, float Level, OUT FActorExtensions& AddedExtensions);
+	void TryGrantGameplayEffect(UAbilitySystemComponent* AbilitySystemComponent, TSubclassOf<UGameplayEffect> EffectType, float Level, OUT FActorExtensions& AddedExtensions);
 
 	/** Handler for AbilitySystem OnGiveAbility delegate. Sets up input binding for clients (not authority) when GameFeatures are activated during Play. */
-	void HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, FGameplayAbilitySpec NewAbilitySpec);
+	void HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, TSubclassOf<UGameplayAbility> AbilityClass);
 
 	/** Does the passed in ability system component have this attribute set? */
 	static bool HasAttributeSet(UAbilitySystemComponent* AbilitySystemComponent, const TSubclassOf<UAttributeSet> Set);
@@ -4,6 +4,7 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
+#include "Abilities/GSCTypes.h"
 #include "GameFramework/Character.h"
 #include "GSCModularCharacter.generated.h"
 
@@ -40,6 +41,19 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Ability System")
 	EGameplayEffectReplicationMode ReplicationMode = EGameplayEffectReplicationMode::Mixed;
 
+	/**
+	 * Ability System Component profile, applied to the ASC before it is initialized.
+	 *
+	 * - Full: Every GAS Companion feature, with the ReplicationMode above.
+	 * - Crowd: Lightweight profile for AI only characters (eg. large crowds). Skips input binding and ability queue plumbing,
+	 * controller change and UI notifications, and forces Minimal replication mode.
+	 *
+	 * Can be set per class, or per spawn (Expose on Spawn, or SpawnActorDeferred from cpp). Full (the default) keeps the
+	 * Profile set on the Ability System Component itself.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|Ability System", meta=(ExposeOnSpawn=true))
+	EGSCAbilitySystemProfile AbilitySystemProfile = EGSCAbilitySystemProfile::Full;
+
 	UPROPERTY(Category=Character, VisibleAnywhere, BlueprintReadOnly, meta=(AllowPrivateAccess = "true"))
 	UGSCAbilitySystemComponent* AbilitySystemComponent;
 
@@ -38,6 +38,43 @@ public:
 	UPROPERTY(Category=PlayerState, VisibleAnywhere, BlueprintReadOnly, meta=(AllowPrivateAccess = "true"))
 	UGSCAbilitySystemComponent* AbilitySystemComponent;
 
+	/**
+	 * Carry over Ability System state (abilities, attribute base values and durable effects) to the new Player State on seamless
+	 * travel and reconnects (CopyProperties / OverrideWith), restored in one batch instead of granting / initializing everything again.
+	 *
+	 * Abilities are only carried over when ASC bResetAbilitiesOnSpawn is false, and attributes when bResetAttributesOnSpawn is false.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Ability System")
+	bool bTransferAbilitySystemState = true;
+
+	/**
+	 * Drive NetUpdateFrequency from Ability System activity (server only).
+	 *
+	 * Ability activation / end, gameplay effect application / removal, gameplay tag and attribute changes on the hosted ASC
+	 * raise NetUpdateFrequency to ActiveNetUpdateFrequency, which decays back to IdleNetUpdateFrequency after ActivityDecayDelay
+	 * seconds without activity.
+	 *
+	 * Opt-in, also requires GASCompanion.PlayerState.AdaptiveNetUpdate 1. The fixed NetUpdateFrequency is used otherwise.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Replication")
+	bool bAdaptiveNetUpdateFrequency = false;
+
+	/** NetUpdateFrequency used while the Ability System is active */
+	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Replication", meta=(EditCondition="bAdaptiveNetUpdateFrequency", ClampMin="0.1"))
+	float ActiveNetUpdateFrequency = 30.f;
+
+	/** NetUpdateFrequency floor used while the Ability System is quiet */
+	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Replication", meta=(EditCondition="bAdaptiveNetUpdateFrequency", ClampMin="0.1"))
+	float IdleNetUpdateFrequency = 2.f;
+
+	/** Seconds without Ability System activity before decaying back to IdleNetUpdateFrequency */
+	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Replication", meta=(EditCondition="bAdaptiveNetUpdateFrequency", ClampMin="0.0", Units="s"))
+	float ActivityDecayDelay = 1.f;
+
+	/** Whether to force a net update when going from idle to active, so that the first change isn't delayed by the idle frequency */
+	UPROPERTY(EditDefaultsOnly, Category="GAS Companion|Replication", meta=(EditCondition="bAdaptiveNetUpdateFrequency"))
+	bool bForceNetUpdateOnActivity = true;
+
 	//~ Begin AActor interface
 	virtual void PreInitializeComponents() override;
 	virtual void BeginPlay() override;
@@ -53,5 +90,42 @@ public:
 protected:
 	//~ Begin APlayerState interface
 	virtual void CopyProperties(APlayerState* PlayerState) override;
+	virtual void OverrideWith(APlayerState* PlayerState) override;
 	//~ End APlayerState interface
+
+	/** Captures Source ASC state and restores it on Target ASC (see bTransferAbilitySystemState) */
+	static void TransferAbilitySystemState(const AGSCModularPlayerState* Source, AGSCModularPlayerState* Target);
+
+	/** Raises NetUpdateFrequency to ActiveNetUpdateFrequency and (re)starts the decay to IdleNetUpdateFrequency */
+	void NotifyAbilitySystemActivity();
+
+private:
+	/** Fixed NetUpdateFrequency (as set in constructor or BP defaults), restored when adaptive net update frequency stops */
+	float FixedNetUpdateFrequency = 0.f;
+
+	bool bAdaptiveNetUpdateRunning = false;
+	bool bAbilitySystemActive = false;
+	double LastActivityTime = 0.0;
+	double LastNetUpdateFrequencyChangeTime = 0.0;
+
+	FTimerHandle NetUpdateDecayTimerHandle;
+	FDelegateHandle AbilityActivatedDelegateHandle;
+	FDelegateHandle AbilityEndedDelegateHandle;
+	FDelegateHandle EffectAppliedDelegateHandle;
+	FDelegateHandle EffectRemovedDelegateHandle;
+	FDelegateHandle GameplayTagChangedDelegateHandle;
+
+	void StartAdaptiveNetUpdateFrequency();
+	void StopAdaptiveNetUpdateFrequency();
+	void RegisterAttributeActivityDelegates();
+	void SetAdaptiveNetUpdateFrequency(float NewFrequency);
+	void HandleNetUpdateDecay();
+
+	void HandleAbilityActorInfoInitialized(UAbilitySystemComponent* InAbilitySystemComponent);
+	void HandleAbilityActivated(UGameplayAbility* Ability);
+	void HandleAbilityEnded(UGameplayAbility* Ability);
+	void HandleGameplayEffectApplied(UAbilitySystemComponent* Source, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void HandleGameplayEffectRemoved(const FActiveGameplayEffect& GameplayEffect);
+	void HandleGameplayTagChanged(FGameplayTag GameplayTag, int32 NewCount);
+	void HandleAttributeChanged(const FOnAttributeChangeData& Data);
 };
@@ -0,0 +1,56 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GSCInputIDSubsystem.generated.h"
+
+/**
+ * World Subsystem handing out Ability Input IDs for GSCAbilityInputBindingComponent.
+ *
+ * IDs are scoped to the world (so that PIE instances or multiple worlds in the same process don't share a counter), and
+ * released IDs are recycled. Acquire always returns the lowest free ID, so IDs stay small and dense and can be used to
+ * index flat arrays.
+ *
+ * Acquire / Release are guarded by a critical section and are safe to call from any thread.
+ */
+UCLASS(DisplayName = "GSC Input ID Subsystem")
+class GASCOMPANION_API UGSCInputIDSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Reserved ID meaning "not bound to any input" (matches the default for unbound ability specs) */
+	static constexpr int32 InvalidInputID = 0;
+
+	//~ Begin USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem interface
+
+	/** Returns the lowest available Input ID and marks it as used. Never returns InvalidInputID. */
+	int32 AcquireInputID();
+
+	/** Marks the passed in Input ID as free, making it available for subsequent calls to AcquireInputID. */
+	void ReleaseInputID(int32 InputID);
+
+	/** Returns the number of Input IDs currently in use. */
+	int32 GetNumUsedInputIDs() const;
+
+	/** Returns the exclusive upper bound of any Input ID handed out so far (size needed for an array indexed by Input ID). */
+	int32 GetInputIDCapacity() const;
+
+	/** Helper to get the subsystem for the world the passed in object lives in. Returns nullptr if object has no world. */
+	static UGSCInputIDSubsystem* Get(const UObject* WorldContextObject);
+
+private:
+	/** Guards UsedInputIDs */
+	mutable FCriticalSection InputIDsCriticalSection;
+
+	/** One bit per Input ID, set if the ID is in use. Bit 0 (InvalidInputID) is always set. */
+	TBitArray<> UsedInputIDs;
+
+	/** Number of bits set in UsedInputIDs, excluding the reserved one */
+	int32 NumUsedInputIDs = 0;
+};
@@ -0,0 +1,50 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GSCPawnControllerSubsystem.generated.h"
+
+class AController;
+class APawn;
+class UGSCAbilitySystemComponent;
+
+/**
+ * Game Instance Subsystem listening to pawn controller changes (possess / unpossess) once for the whole game instance,
+ * and routing them to the Ability System Component of the affected pawn, so that cached AbilityActorInfo can be updated.
+ *
+ * Ability System Components living on pawns register themselves from InitAbilityActorInfo. Each possession event is
+ * a single map lookup, instead of notifying every Ability System Component in the world.
+ */
+UCLASS(DisplayName = "GSC Pawn Controller Subsystem")
+class GASCOMPANION_API UGSCPawnControllerSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem interface
+
+	/** Routes controller changes of Pawn to AbilitySystemComponent. Replaces any component previously registered for Pawn. */
+	void RegisterAbilitySystem(APawn* Pawn, UGSCAbilitySystemComponent* AbilitySystemComponent);
+
+	/** Stops routing controller changes of Pawn, if they are routed to AbilitySystemComponent */
+	void UnregisterAbilitySystem(const APawn* Pawn, const UGSCAbilitySystemComponent* AbilitySystemComponent);
+
+	/** Returns the number of pawns currently registered */
+	int32 GetNumRegisteredPawns() const { return AbilitySystemComponents.Num(); }
+
+	/** Helper to get the subsystem for the game instance the passed in object lives in. Returns nullptr if object has no game instance. */
+	static UGSCPawnControllerSubsystem* Get(const UObject* WorldContextObject);
+
+private:
+	TMap<TObjectKey<APawn>, TWeakObjectPtr<UGSCAbilitySystemComponent>> AbilitySystemComponents;
+
+	/** Handler for GameInstance OnPawnControllerChanged */
+	UFUNCTION()
+	void HandlePawnControllerChanged(APawn* Pawn, AController* NewController);
+};
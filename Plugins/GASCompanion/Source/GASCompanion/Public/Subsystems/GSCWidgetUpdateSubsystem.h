@@ -0,0 +1,97 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GSCWidgetUpdateSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGSCUserWidget;
+struct FOnAttributeChangeData;
+
+/**
+ * World Subsystem owning attribute change subscriptions for world space GSC User Widgets (typically floating health bars
+ * used with a Widget Component, with bUseSharedUpdateScheduler turned on).
+ *
+ * Attribute changes are subscribed to once per Ability System Component, no matter how many widgets display it, and
+ * accumulated per widget. Widgets are then updated at most once per frame, or at a reduced rate based on distance to
+ * the local viewer and visibility (see "User Widgets" category in GAS Companion developer settings).
+ */
+UCLASS(DisplayName = "GSC Widget Update Subsystem")
+class GASCOMPANION_API UGSCWidgetUpdateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem interface
+
+	//~ Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject interface
+
+	/** Registers Widget for attribute updates from AbilitySystemComponent. Widget is unregistered from any previous ASC. */
+	void RegisterWidget(UGSCUserWidget* Widget, UAbilitySystemComponent* AbilitySystemComponent);
+
+	/** Stops updates for Widget, and unsubscribe from its ASC if no other widgets are using it */
+	void UnregisterWidget(const UGSCUserWidget* Widget);
+
+	/** Returns the number of widgets currently registered */
+	int32 GetNumRegisteredWidgets() const { return Widgets.Num(); }
+
+	/** Helper to get the subsystem for the world the passed in object lives in. Returns nullptr if object has no world. */
+	static UGSCWidgetUpdateSubsystem* Get(const UObject* WorldContextObject);
+
+private:
+	struct FPendingAttributeChange
+	{
+		FGameplayAttribute Attribute;
+		float OldValue = 0.f;
+		float NewValue = 0.f;
+	};
+
+	struct FWidgetEntry
+	{
+		TWeakObjectPtr<UGSCUserWidget> Widget;
+		TObjectKey<UAbilitySystemComponent> AbilitySystemComponent;
+
+		/** Changes received since last update, one per attribute (oldest OldValue, latest NewValue) */
+		TArray<FPendingAttributeChange> PendingChanges;
+
+		/** World time at which this widget may be updated next */
+		double NextUpdateTime = 0.0;
+	};
+
+	struct FAbilitySystemSubscription
+	{
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+		TArray<TPair<FGameplayAttribute, FDelegateHandle>> AttributeHandles;
+		TArray<TObjectKey<UGSCUserWidget>> Widgets;
+	};
+
+	TMap<TObjectKey<UGSCUserWidget>, FWidgetEntry> Widgets;
+	TMap<TObjectKey<UAbilitySystemComponent>, FAbilitySystemSubscription> Subscriptions;
+
+	/** Number of registered widgets with pending changes, Tick is a no-op when 0 (apart from the periodic prune of dead widgets) */
+	int32 NumDirtyWidgets = 0;
+
+	/** World time at which registered widgets are next checked for garbage collected ones */
+	double NextPruneTime = 0.0;
+
+	/** Removes widget entry, and unsubscribe from its ASC if no other widgets are using it. Shared by UnregisterWidget and dead widgets cleanup. */
+	void RemoveWidget(TObjectKey<UGSCUserWidget> WidgetKey);
+
+	/** Single handler for every subscribed ASC attribute */
+	void HandleAttributeChanged(const FOnAttributeChangeData& Data, TObjectKey<UAbilitySystemComponent> AbilitySystemComponentKey);
+
+	/** Remove every attribute delegates bound for Subscription */
+	static void Unsubscribe(FAbilitySystemSubscription& Subscription);
+
+	/** Returns the update interval for Widget, based on its distance to ViewLocation and visibility */
+	static float GetUpdateInterval(const UGSCUserWidget& Widget, const FVector& ViewLocation, bool bHasViewLocation);
+};
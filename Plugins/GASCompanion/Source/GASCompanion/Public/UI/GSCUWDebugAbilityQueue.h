@@ -14,9 +14,12 @@ class UCanvasPanel;
 class UAnimSequenceBase;
 
 /**
+ * Debug widget displaying Ability Queue Component state.
  *
+ * Refreshed on ability queue events only (no tick). Row text blocks are pooled and reused, and "From Montage" rows
+ * expire through a single timer.
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class GASCOMPANION_API UGSCUWDebugAbilityQueue : public UGSCUserWidget
 {
 	GENERATED_BODY()
@@ -55,20 +58,39 @@ public:
 	 */
 	virtual void StartClearFromMontageRowTimer();
 
+	/**
+	 * Updates Enabled / Opened / Current Queued Ability / Allow All texts from the owner ability queue component
+	 */
+	virtual void RefreshAbilityQueueState();
+
 protected:
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 	
 	void OnAddAbilityQueueFromMontageRow(UAnimSequenceBase* Anim);
 	void OnUpdateAllowedAbilities(TArray<TSubclassOf<UGameplayAbility>> Abilities);
+	void OnAbilityQueueStateChanged(const UGSCAbilityQueueComponent* AbilityQueueComponent);
 
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	virtual void ClearFromMontageRow();
 
 	TWeakObjectPtr<AActor> OwnerActor;
 	TWeakObjectPtr<UGSCAbilityQueueComponent> OwnerAbilityQueueComponent;
 
-	TArray<FTimerHandle> ClearFromMontageTimerHandles;
+	/** Single timer, re-armed to the next row expiry time */
+	FTimerHandle ClearFromMontageTimerHandle;
+
+	/** World times (sorted) at which the oldest "From Montage" row should be cleared */
+	TArray<double> ClearFromMontageTimes;
+
+	/** Names displayed in "From Montage" rows, oldest first */
+	TArray<FText> FromMontageRowTexts;
+
+	/** Pooled rows, created once and collapsed when not used */
+	UPROPERTY(Transient)
+	TArray<UTextBlock*> AllowedAbilityRows;
+
+	UPROPERTY(Transient)
+	TArray<UTextBlock*> FromMontageRows;
 
 	FLinearColor WhiteColor = FLinearColor(1.f, 1.f, 1.f, 1.f);
 	FLinearColor GreenColor = FLinearColor(0.729412f, 0.854902f, 0.333333f, 1.f);
@@ -114,4 +136,26 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget), Category = "GAS Companion|UI")
 	UCanvasPanel* AbilityQueueFromMontagesPanel = nullptr;
+
+private:
+	/** Returns row at Index in Rows, duplicating Template and adding it to Box if pool doesn't have enough rows yet */
+	UTextBlock* GetOrCreateRow(TArray<UTextBlock*>& Rows, int32 Index, UTextBlock* Template, UVerticalBox* Box);
+
+	/** Collapse pooled rows from Index onward */
+	static void CollapseRows(const TArray<UTextBlock*>& Rows, int32 Index);
+
+	/** Sets text only if different, and make sure row is visible */
+	static void SetRowText(UTextBlock* Row, const FText& Text);
+
+	/** Sets text / color for one of the state text blocks, if changed */
+	static void SetStateText(UTextBlock* TextBlock, const FText& Text, const FLinearColor& Color);
+
+	/** Push montage rows texts to pooled widgets, and collapse the panel if there's none */
+	void RefreshFromMontageRows();
+
+	/** Arm the timer for the next row expiry, if any */
+	void ScheduleNextClearFromMontageRow();
+
+	/** Timer callback, clears every rows that expired */
+	void OnClearFromMontageTimer();
 };
@@ -23,8 +23,12 @@ class UTextBlock;
  *
  * The other main difference with UGSCUserWidget is that this class also defines widget optional binding for
  * Health / Stamina / Mana attributes from UGSCAttributeSet.
+ *
+ * If the Ability System Component is not ready on NativeConstruct (typically ASC on Player States for clients), the widget
+ * waits for the owning pawn's UGSCAbilitySystemComponent to be initialized (FGSCDelegates::OnAbilityActorInfoInitialized).
+ * This widget doesn't tick natively.
  */
-UCLASS()
+UCLASS(meta = (DisableNativeTick))
 class GASCOMPANION_API UGSCUWHud : public UGSCUserWidget
 {
 	GENERATED_BODY()
@@ -33,7 +37,6 @@ protected:
 	//~ Begin UUserWidget interface
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	//~ End UUserWidget interface
 	
 public:
@@ -80,9 +83,17 @@ public:
 
 
 protected:
-	/** Set in native construct if called too early to check for ASC in tick, and kick off initialization logic when it is ready */
+	/** Set in native construct if called too early, and kick off initialization logic when the ASC is ready */
 	bool bLazyAbilitySystemInitialization = false;
 
+	/**
+	 * Minimum delay in seconds between two refreshes of the attribute widgets, when attributes change.
+	 *
+	 * Changes are accumulated and widgets refreshed at most once per interval. 0 means once per frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "GAS Companion|UI", meta = (ClampMin = "0.0", UIMin = "0.0", ForceUnits = "s"))
+	float AttributeRefreshInterval = 0.f;
+
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional), Category = "GAS Companion|UI")
 	UTextBlock* HealthText = nullptr;
 
@@ -106,14 +117,70 @@ protected:
 
 
 private:
+	/** Last known and last displayed values for one of the attribute / max attribute pair */
+	struct FAttributeWidgetState
+	{
+		float Value = 0.f;
+		float MaxValue = 0.f;
+
+		int32 DisplayedValue = INDEX_NONE;
+		int32 DisplayedMaxValue = INDEX_NONE;
+		float DisplayedPercent = -1.f;
+
+		bool bDirty = false;
+
+		/** Max attribute changed, refresh goes through the SetMax* setter (which also picks up the current value) */
+		bool bMaxDirty = false;
+
+		/** Forget displayed values, so that next refresh updates widgets unconditionally */
+		void ResetDisplayed()
+		{
+			DisplayedValue = INDEX_NONE;
+			DisplayedMaxValue = INDEX_NONE;
+			DisplayedPercent = -1.f;
+		}
+	};
+
+	FAttributeWidgetState HealthState;
+	FAttributeWidgetState StaminaState;
+	FAttributeWidgetState ManaState;
+
+	/** Pending refresh of dirty attribute widgets */
+	FTimerHandle RefreshAttributesTimerHandle;
+
 	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
 
 	/** Array of tags bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FGameplayTag> GameplayTagBoundToDelegates;
 
+	/** Frame number and time when lazy initialization started, to report how long the widget waited for its ASC */
+	uint64 LazyInitializationStartFrame = 0;
+	double LazyInitializationStartTime = 0.0;
+
 	static FString GetAttributeFormatString(float BaseValue, float MaxValue);
 
+	/** Returns the "Value / MaxValue" text for the given values, reusing previously formatted text for common values */
+	static const FText& GetAttributeText(int32 Value, int32 MaxValue);
+
+	/** Sets text on TextBlock unless the displayed integer values are unchanged */
+	static void UpdateAttributeText(FAttributeWidgetState& State, UTextBlock* TextBlock);
+
+	/** Returns true and the new percent if it differs from the displayed one */
+	static bool ShouldUpdateAttributePercent(FAttributeWidgetState& State, float& OutPercent);
+
+	/** Flag the state (or its max value) dirty and schedule a refresh, if not already scheduled */
+	void MarkAttributeDirty(FAttributeWidgetState& State, bool bMaxValue = false);
+
+	/** Refresh widgets for every dirty attribute */
+	void RefreshDirtyAttributes();
+
+	/** Handler for FGSCDelegates::OnAbilityActorInfoInitialized, used for lazy initialization */
+	void HandleAbilityActorInfoInitialized(UAbilitySystemComponent* InAbilitySystemComponent);
+
+	/** Stop listening for ASC initialization */
+	void StopLazyAbilitySystemInitialization();
+
 	/**
 	 * Checks owner for a valid ASC and kick in initialization logic if it finds one
 	 *
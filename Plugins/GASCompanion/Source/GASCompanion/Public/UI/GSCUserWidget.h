@@ -7,44 +7,11 @@
 #include "AttributeSet.h"
 #include "GameplayAbilitySpec.h"
 #include "GameplayEffectTypes.h"
+#include "Abilities/GSCTypes.h"
 #include "GSCUserWidget.generated.h"
 
 class UGSCCoreComponent;
 
-USTRUCT(BlueprintType)
-struct FGSCGameplayEffectUIData
-{
-	GENERATED_BODY()
-
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
-	float StartTime;
-
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
-	float TotalDuration;
-
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
-	float ExpectedEndTime;
-
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
-	int32 StackCount;
-
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|GameplayEffect")
-	int32 StackLimitCount;
-
-	FGSCGameplayEffectUIData(const float StartTime, const float TotalDuration, const float ExpectedEndTime, const int32 StackCount, const int32 StackLimitCount)
-		: StartTime(StartTime),
-		  TotalDuration(TotalDuration),
-		  ExpectedEndTime(ExpectedEndTime),
-		  StackCount(StackCount),
-		  StackLimitCount(StackLimitCount)
-	{
-	}
-
-	FGSCGameplayEffectUIData(): StartTime(0), TotalDuration(0), ExpectedEndTime(0), StackCount(0), StackLimitCount(0)
-	{
-	}
-};
-
 /**
  * Base user widget class to inherit from for UMG that needs to interact with an Ability System Component.
  *
@@ -68,6 +35,16 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category="GAS Companion|UI", meta=(DeprecatedFunction, DeprecationMessage="Use GetOwningCoreComponent() instead."))
 	UGSCCoreComponent* OwnerCoreComponent;
+
+	/**
+	 * Let the GSC Widget Update Subsystem handle attribute change subscriptions for this widget, instead of binding to every
+	 * attribute of the ASC.
+	 *
+	 * Meant for world space widgets displayed in large numbers (like floating health bars with a Widget Component). Attribute
+	 * changes are batched and OnAttributeChange is triggered at most once per frame, or less often for far away or hidden widgets.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="GAS Companion|UI")
+	bool bUseSharedUpdateScheduler = false;
 	
 	/** Initialize or update references to owner actor and additional actor components (such as AbilitySystemComponent) and cache them for this instance of user widget. */
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|UI")
@@ -200,14 +177,23 @@ public:
 	/** Trigger from ASC whenever an cooldown tag stack changes, and stack count is 0 (cooldown end) */
 	virtual void HandleCooldownEnd(UGameplayAbility* Ability, FGameplayTag CooldownTag, float Duration);
 	
-	FGSCGameplayEffectUIData GetGameplayEffectUIData(FActiveGameplayEffectHandle ActiveHandle);
+	/** Returns UI data for the active gameplay effect (looked up once on this widget ASC, or the effect being removed) */
+	FGSCGameplayEffectUIData GetGameplayEffectUIData(FActiveGameplayEffectHandle ActiveHandle) const;
 
 protected:
 	
 	UPROPERTY()
 	UAbilitySystemComponent* AbilitySystemComponent;
+
+	//~ Begin UUserWidget interface
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+	//~ End UUserWidget interface
 	
 private:
+
+	/** Set while handling OnAnyGameplayEffectRemoved, the effect is pending removal and can't be looked up by handle anymore */
+	const FActiveGameplayEffect* RemovedGameplayEffect = nullptr;
 	
 	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
 	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
@@ -47,7 +47,10 @@ public class GASCompanionEditor : ModuleRules
 				"NavigationSystem",
 				"GameplayTags",
 				"GameplayTagsEditor",
-				"UATHelper"
+				"UATHelper",
+				"UMG",
+				"GameFeatures",
+				"Json"
 			}
 		);
 	}
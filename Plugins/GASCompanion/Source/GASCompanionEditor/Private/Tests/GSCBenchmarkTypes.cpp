@@ -0,0 +1,65 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Tests/GSCBenchmarkTypes.h"
+
+#include "Abilities/Attributes/GSCAttributeSet.h"
+
+namespace GSCBenchmarkTypes_Impl
+{
+	static FGameplayModifierInfo MakeAdditiveModifier(const FGameplayAttribute& Attribute, const float Magnitude)
+	{
+		FGameplayModifierInfo ModifierInfo;
+		ModifierInfo.Attribute = Attribute;
+		ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+		ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(Magnitude));
+		return ModifierInfo;
+	}
+}
+
+UGSCBenchmarkCostEffect::UGSCBenchmarkCostEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+	Modifiers.Add(GSCBenchmarkTypes_Impl::MakeAdditiveModifier(UGSCAttributeSet::GetStaminaAttribute(), -1.f));
+}
+
+UGSCBenchmarkDamageEffect::UGSCBenchmarkDamageEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+	Modifiers.Add(GSCBenchmarkTypes_Impl::MakeAdditiveModifier(UGSCAttributeSet::GetDamageAttribute(), 1.f));
+}
+
+UGSCBenchmarkAbility::UGSCBenchmarkAbility()
+{
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+	CostGameplayEffectClass = UGSCBenchmarkCostEffect::StaticClass();
+	bLooselyCheckAbilityCost = true;
+}
+
+void UGSCBenchmarkAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
+{
+	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
+	{
+		CancelAbility(Handle, ActorInfo, ActivationInfo, false);
+		return;
+	}
+
+	EndAbility(Handle, ActorInfo, ActivationInfo, false, false);
+}
+
+UGSCBenchmarkUserWidget::UGSCBenchmarkUserWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bUseSharedUpdateScheduler = true;
+}
+
+void UGSCBenchmarkUserWidget::OnAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	NumAttributeUpdates++;
+	Super::OnAttributeChanged(Data);
+}
+
+void UGSCBenchmarkUserWidget::RunDestructConstructCycle()
+{
+	NativeDestruct();
+	NativeConstruct();
+}
@@ -0,0 +1,80 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/Attributes/GSCAttributeSetBase.h"
+#include "UI/GSCUserWidget.h"
+
+#include "GSCBenchmarkTypes.generated.h"
+
+/**
+ * Native types used by GASCompanion.Benchmarks automation spec. Not meant to be used outside of it.
+ */
+
+/** Instant Gameplay Effect consuming 1 Stamina, used as cost for UGSCBenchmarkAbility */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGSCBenchmarkCostEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGSCBenchmarkCostEffect();
+};
+
+/** Instant Gameplay Effect dealing 1 Damage (meta attribute), used for effect container application */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGSCBenchmarkDamageEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGSCBenchmarkDamageEffect();
+};
+
+/** Instanced per actor ability, loosely checking its cost and ending right away when activated */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGSCBenchmarkAbility : public UGSCGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UGSCBenchmarkAbility();
+
+	//~ Begin UGameplayAbility interface
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+	//~ End UGameplayAbility interface
+};
+
+/** Separate ability type granted by the benchmark Game Feature action, so that it's not filtered out as already granted */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGSCBenchmarkGameFeatureAbility : public UGSCBenchmarkAbility
+{
+	GENERATED_BODY()
+};
+
+/** Empty attribute set granted by the benchmark Game Feature action, separate from UGSCAttributeSet already granted to characters */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGSCBenchmarkGameFeatureAttributeSet : public UGSCAttributeSetBase
+{
+	GENERATED_BODY()
+};
+
+/** User widget relying on the shared update scheduler, counting attribute updates it received */
+UCLASS(NotBlueprintable, HideDropdown)
+class UGSCBenchmarkUserWidget : public UGSCUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	UGSCBenchmarkUserWidget(const FObjectInitializer& ObjectInitializer);
+
+	int32 NumAttributeUpdates = 0;
+
+	virtual void OnAttributeChanged(const FOnAttributeChangeData& Data) override;
+
+	/** Runs NativeDestruct then NativeConstruct, as when the widget is removed from its parent and added back */
+	void RunDestructConstructCycle();
+};
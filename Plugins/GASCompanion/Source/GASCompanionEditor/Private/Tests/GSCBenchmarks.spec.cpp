@@ -0,0 +1,708 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFeaturesSubsystem.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/GSCCoreComponent.h"
+#include "Core/Debug/GSCMemoryReport.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "GameFeatures/Actions/GSCGameFeatureAction_AddAbilities.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ModularGameplayActors/GSCModularCharacter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Subsystems/GSCWidgetUpdateSubsystem.h"
+#include "Tests/GSCBenchmarkTypes.h"
+
+/**
+ * Headless throughput benchmarks. Meant to be run with -nullrhi, eg.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -nullrhi -unattended -nosplash -ExecCmds="Automation RunTests GASCompanion.Benchmarks; Quit"
+ *
+ * Command line options:
+ *
+ * -GSCBenchmarkActors=<N>			Number of AGSCModularCharacter spawned for each benchmark (default 100)
+ * -GSCBenchmarkCrowdActors=<N>		Number of characters spawned for Full vs Crowd ASC profile benchmarks (default 1000)
+ * -GSCBenchmarkIterations=<N>		Number of measured iterations, median is reported (default 10)
+ * -GSCBenchmarkOutput=<Path>		JSON results output (default <Project>/Saved/Automation/GASCompanion/Benchmarks.json)
+ * -GSCBenchmarkBaseline=<Path>		JSON baseline to compare against (default <Plugin>/Resources/Benchmarks/Baseline.json)
+ * -GSCBenchmarkTolerance=<Ratio>	Allowed slowdown against baseline before failing (default 0.25, eg. 25% slower)
+ * -GSCBenchmarkWriteBaseline		Writes results to the baseline path as well (to update it from a reference machine)
+ *
+ * Results are reported as microseconds per operation. A benchmark slower than its baseline value by more than the
+ * tolerance fails the test, so regressions fail CI. Benchmarks without a baseline value are only reported, and a missing
+ * baseline file is reported as a warning.
+ */
+BEGIN_DEFINE_SPEC(FGSCBenchmarksSpec, "GASCompanion.Benchmarks", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::ApplicationContextMask)
+
+	UGameInstance* GameInstance = nullptr;
+	UWorld* World = nullptr;
+	TArray<AGSCModularCharacter*> Characters;
+
+	int32 NumActors = 100;
+	int32 NumCrowdActors = 1000;
+	int32 NumIterations = 10;
+	float Tolerance = 0.25f;
+
+	/** Results of benchmarks run so far, in microseconds per operation */
+	TMap<FString, double> Results;
+
+	void SetupWorld();
+	void TeardownWorld();
+
+	/** Spawns a character at Index (spawn grid position) with the given ASC profile, benchmark ability, GSC attribute set and a core component */
+	AGSCModularCharacter* SpawnCharacter(int32 Index, EGSCAbilitySystemProfile Profile) const;
+
+	/** Spawn and ability activation benchmarks for NumCrowdActors characters with the given ASC profile */
+	void DefineCrowdBenchmarks(EGSCAbilitySystemProfile Profile);
+
+	UGSCAbilitySystemComponent* GetASC(const int32 Index) const { return Characters[Index]->AbilitySystemComponent; }
+
+	/** Returns the granted instance of UGSCBenchmarkAbility for actor at Index */
+	UGSCBenchmarkAbility* GetBenchmarkAbility(const int32 Index) const;
+
+	/** Runs Body once to warm up, then NumIterations times, and returns the median time per operation in microseconds. Reset is run after each iteration, outside of measurement. */
+	double Measure(int32 NumOps, TFunctionRef<void()> Body, TFunctionRef<void()> Reset) const;
+	double Measure(const int32 NumOps, const TFunctionRef<void()> Body) const { return Measure(NumOps, Body, []() {}); }
+
+	/** Stores and compares the result against baseline, then writes all results so far as JSON */
+	void ReportResult(const FString& Name, double MicrosecondsPerOp);
+
+	FString GetOutputPath() const;
+	FString GetBaselinePath() const;
+
+	static TSharedRef<FJsonObject> MakeResultsJson(const TMap<FString, double>& InResults, int32 InNumActors, int32 InNumIterations);
+	static bool WriteJson(const TSharedRef<FJsonObject>& JsonObject, const FString& Filename);
+
+END_DEFINE_SPEC(FGSCBenchmarksSpec)
+
+void FGSCBenchmarksSpec::Define()
+{
+	FParse::Value(FCommandLine::Get(), TEXT("GSCBenchmarkActors="), NumActors);
+	FParse::Value(FCommandLine::Get(), TEXT("GSCBenchmarkCrowdActors="), NumCrowdActors);
+	FParse::Value(FCommandLine::Get(), TEXT("GSCBenchmarkIterations="), NumIterations);
+	FParse::Value(FCommandLine::Get(), TEXT("GSCBenchmarkTolerance="), Tolerance);
+	NumActors = FMath::Max(NumActors, 1);
+	NumCrowdActors = FMath::Max(NumCrowdActors, 1);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	BeforeEach([this]()
+	{
+		SetupWorld();
+	});
+
+	AfterEach([this]()
+	{
+		TeardownWorld();
+	});
+
+	Describe(TEXT("Abilities"), [this]()
+	{
+		It(TEXT("grants default abilities and attributes"), [this]()
+		{
+			const double Result = Measure(Characters.Num(), [this]()
+			{
+				for (AGSCModularCharacter* Character : Characters)
+				{
+					Character->AbilitySystemComponent->GrantDefaultAbilitiesAndAttributes(Character, Character);
+				}
+			});
+
+			ReportResult(TEXT("GrantDefaultAbilitiesAndAttributes"), Result);
+		});
+
+		It(TEXT("activates abilities by class"), [this]()
+		{
+			TArray<UGSCCoreComponent*> CoreComponents;
+			for (const AGSCModularCharacter* Character : Characters)
+			{
+				CoreComponents.Add(Character->FindComponentByClass<UGSCCoreComponent>());
+			}
+
+			int32 NumActivated = 0;
+			const double Result = Measure(CoreComponents.Num(), [&CoreComponents, &NumActivated]()
+			{
+				for (UGSCCoreComponent* CoreComponent : CoreComponents)
+				{
+					UGSCGameplayAbility* ActivatedAbility = nullptr;
+					NumActivated += CoreComponent->ActivateAbilityByClass(UGSCBenchmarkAbility::StaticClass(), ActivatedAbility) ? 1 : 0;
+				}
+			});
+
+			TestEqual(TEXT("All activations succeeded"), NumActivated, CoreComponents.Num() * (NumIterations + 1));
+			ReportResult(TEXT("ActivateAbilityByClass"), Result);
+		});
+
+		It(TEXT("polls CanActivateAbility with loose cost check"), [this]()
+		{
+			constexpr int32 NumPollsPerActor = 10;
+
+			int32 NumPassed = 0;
+			const double Result = Measure(Characters.Num() * NumPollsPerActor, [this, &NumPassed]()
+			{
+				for (int32 Index = 0; Index < Characters.Num(); ++Index)
+				{
+					const UGSCBenchmarkAbility* Ability = GetBenchmarkAbility(Index);
+					const FGameplayAbilitySpecHandle Handle = Ability->GetCurrentAbilitySpecHandle();
+					const FGameplayAbilityActorInfo* ActorInfo = Ability->GetCurrentActorInfo();
+					for (int32 Poll = 0; Poll < NumPollsPerActor; ++Poll)
+					{
+						NumPassed += Ability->CanActivateAbility(Handle, ActorInfo, nullptr, nullptr, nullptr) ? 1 : 0;
+					}
+				}
+			});
+
+			TestEqual(TEXT("All checks passed"), NumPassed, Characters.Num() * NumPollsPerActor * (NumIterations + 1));
+			ReportResult(TEXT("CanActivateAbility_LooseCost"), Result);
+		});
+
+		It(TEXT("reports mapped abilities bookkeeping size for a 50 abilities loadout"), [this]()
+		{
+			constexpr int32 NumAbilities = 50;
+
+			AGSCModularCharacter* Character = Characters[0];
+			UGSCAbilitySystemComponent* ASC = GetASC(0);
+			const FGSCMemoryFootprint FootprintBefore = FGSCMemoryReport::GetFootprint(ASC);
+
+			// bResetAbilitiesOnSpawn skips the ShouldGrantAbility class check, so the same ability goes through GiveAbility and is mapped 50 times
+			const FGSCAbilityInputMapping AbilityMapping = ASC->GrantedAbilities[0];
+			ASC->bResetAbilitiesOnSpawn = true;
+			ASC->GrantedAbilities.Init(AbilityMapping, NumAbilities);
+			ASC->GrantDefaultAbilitiesAndAttributes(Character, Character);
+
+			int32 NumGranted = 0;
+			SIZE_T SpecCopiesBytes = 0;
+			for (const FGameplayAbilitySpec& AbilitySpec : ASC->GetActivatableAbilities())
+			{
+				if (AbilitySpec.Ability && AbilitySpec.Ability->GetClass() == AbilityMapping.Ability)
+				{
+					NumGranted++;
+
+					// Before slimming, each mapped ability held a full spec copy in place of the ability class
+					SpecCopiesBytes += sizeof(FGameplayAbilitySpec) - sizeof(TSubclassOf<UGameplayAbility>) + FGSCMemoryReport::GetAllocatedSize(AbilitySpec);
+				}
+			}
+
+			const FGSCMemoryFootprint FootprintAfter = FGSCMemoryReport::GetFootprint(ASC);
+			const SIZE_T BookkeepingBytes = FootprintAfter.Bookkeeping;
+			const SIZE_T LegacyBookkeepingBytes = BookkeepingBytes + SpecCopiesBytes;
+
+			TestEqual(TEXT("Every ability granted"), NumGranted, NumAbilities);
+			TestTrue(TEXT("Mapped abilities are accounted in bookkeeping"), BookkeepingBytes >= FootprintBefore.Bookkeeping + (NumAbilities - 1) * sizeof(FGSCMappedAbility));
+			AddInfo(FString::Printf(
+				TEXT("MappedAbilities_%d: %llu bytes of bookkeeping per character (%llu bytes with full spec copies, saves %llu bytes). Total footprint: %llu bytes"),
+				NumAbilities,
+				static_cast<uint64>(BookkeepingBytes),
+				static_cast<uint64>(LegacyBookkeepingBytes),
+				static_cast<uint64>(SpecCopiesBytes),
+				static_cast<uint64>(FootprintAfter.GetTotal())
+			));
+		});
+	});
+
+	Describe(TEXT("Effects"), [this]()
+	{
+		for (const int32 NumTargets : { 1, 10, 100 })
+		{
+			It(FString::Printf(TEXT("applies effect container to %d targets"), NumTargets), [this, NumTargets]()
+			{
+				if (Characters.Num() < NumTargets)
+				{
+					AddWarning(FString::Printf(TEXT("Only %d actors spawned, can't benchmark %d targets (see -GSCBenchmarkActors)"), Characters.Num(), NumTargets));
+					return;
+				}
+
+				UGSCBenchmarkAbility* Ability = GetBenchmarkAbility(0);
+				if (!Ability)
+				{
+					AddError(TEXT("Benchmark ability was not granted"));
+					return;
+				}
+
+				TArray<AActor*> TargetActors;
+				for (int32 Index = 0; Index < NumTargets; ++Index)
+				{
+					TargetActors.Add(Characters[Index]);
+				}
+
+				FGSCGameplayEffectContainerSpec ContainerSpec;
+				ContainerSpec.TargetGameplayEffectSpecs.Add(Ability->MakeOutgoingGameplayEffectSpec(UGSCBenchmarkDamageEffect::StaticClass()));
+				ContainerSpec.AddTargets(TArray<FHitResult>(), TargetActors);
+
+				int32 NumApplied = 0;
+				const double Result = Measure(NumTargets, [Ability, &ContainerSpec, &NumApplied]()
+				{
+					NumApplied += Ability->ApplyEffectContainerSpecBatched(ContainerSpec).NumApplied;
+				});
+
+				TestEqual(TEXT("Effects applied to all targets"), NumApplied, NumTargets * (NumIterations + 1));
+				ReportResult(FString::Printf(TEXT("ApplyEffectContainerSpec_%dTargets"), NumTargets), Result);
+			});
+		}
+	});
+
+	Describe(TEXT("Attributes"), [this]()
+	{
+		It(TEXT("broadcasts attribute changes"), [this]()
+		{
+			float Value = 0.f;
+			const double Result = Measure(Characters.Num(), [this, &Value]()
+			{
+				Value = Value > 500.f ? 100.f : Value + 1.f;
+				for (AGSCModularCharacter* Character : Characters)
+				{
+					Character->AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute(), Value);
+				}
+			});
+
+			ReportResult(TEXT("AttributeChangeBroadcast"), Result);
+		});
+
+		It(TEXT("dispatches shared widget updates"), [this]()
+		{
+			UGSCWidgetUpdateSubsystem* Subsystem = UGSCWidgetUpdateSubsystem::Get(World);
+			if (!Subsystem)
+			{
+				AddError(TEXT("No GSC Widget Update Subsystem for benchmark world"));
+				return;
+			}
+
+			TArray<UGSCBenchmarkUserWidget*> Widgets;
+			for (AGSCModularCharacter* Character : Characters)
+			{
+				UGSCBenchmarkUserWidget* Widget = CreateWidget<UGSCBenchmarkUserWidget>(World, UGSCBenchmarkUserWidget::StaticClass());
+				Widget->InitializeWithAbilitySystem(Character->AbilitySystemComponent);
+				Widgets.Add(Widget);
+			}
+
+			TestEqual(TEXT("All widgets registered"), Subsystem->GetNumRegisteredWidgets(), Widgets.Num());
+
+			// Widgets are hidden (not in viewport), benchmark dispatch every frame by not throttling hidden widgets
+			UGSCDeveloperSettings* Settings = GetMutableDefault<UGSCDeveloperSettings>();
+			const float PreviousHiddenInterval = Settings->WidgetUpdateHiddenInterval;
+			Settings->WidgetUpdateHiddenInterval = 0.f;
+
+			constexpr float DeltaTime = 1.f / 60.f;
+			float Value = 0.f;
+			const double Result = Measure(Characters.Num(), [this, Subsystem, &Value]()
+			{
+				// A few changes per frame and per actor, merged by the subsystem into a single update per widget
+				for (int32 Change = 0; Change < 3; ++Change)
+				{
+					Value = Value > 500.f ? 100.f : Value + 1.f;
+					for (AGSCModularCharacter* Character : Characters)
+					{
+						Character->AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute(), Value);
+					}
+				}
+
+				Subsystem->Tick(DeltaTime);
+			});
+
+			Settings->WidgetUpdateHiddenInterval = PreviousHiddenInterval;
+
+			int32 NumUpdates = 0;
+			for (const UGSCBenchmarkUserWidget* Widget : Widgets)
+			{
+				NumUpdates += Widget->NumAttributeUpdates;
+			}
+
+			TestEqual(TEXT("One update per widget and frame"), NumUpdates, Widgets.Num() * (NumIterations + 1));
+			ReportResult(TEXT("WidgetUpdateSubsystem"), Result);
+
+			for (UGSCBenchmarkUserWidget* Widget : Widgets)
+			{
+				Subsystem->UnregisterWidget(Widget);
+			}
+		});
+
+		It(TEXT("registers shared update widgets again after a destruct / construct cycle"), [this]()
+		{
+			UGSCWidgetUpdateSubsystem* Subsystem = UGSCWidgetUpdateSubsystem::Get(World);
+			if (!Subsystem)
+			{
+				AddError(TEXT("No GSC Widget Update Subsystem for benchmark world"));
+				return;
+			}
+
+			UGSCBenchmarkUserWidget* Widget = CreateWidget<UGSCBenchmarkUserWidget>(World, UGSCBenchmarkUserWidget::StaticClass());
+			Widget->InitializeWithAbilitySystem(Characters[0]->AbilitySystemComponent);
+			const int32 NumRegisteredWidgets = Subsystem->GetNumRegisteredWidgets();
+
+			Widget->RunDestructConstructCycle();
+			TestEqual(TEXT("Widget registered again"), Subsystem->GetNumRegisteredWidgets(), NumRegisteredWidgets);
+
+			// Widget is hidden (not in viewport), don't throttle its update
+			UGSCDeveloperSettings* Settings = GetMutableDefault<UGSCDeveloperSettings>();
+			const float PreviousHiddenInterval = Settings->WidgetUpdateHiddenInterval;
+			Settings->WidgetUpdateHiddenInterval = 0.f;
+
+			Characters[0]->AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute(), 42.f);
+			Subsystem->Tick(1.f / 60.f);
+
+			Settings->WidgetUpdateHiddenInterval = PreviousHiddenInterval;
+			TestTrue(TEXT("Widget received attribute updates after the cycle"), Widget->NumAttributeUpdates > 0);
+
+			Subsystem->UnregisterWidget(Widget);
+		});
+	});
+
+	Describe(TEXT("Crowd"), [this]()
+	{
+		DefineCrowdBenchmarks(EGSCAbilitySystemProfile::Full);
+		DefineCrowdBenchmarks(EGSCAbilitySystemProfile::Crowd);
+	});
+
+	Describe(TEXT("Game Features"), [this]()
+	{
+		It(TEXT("activates add abilities action"), [this]()
+		{
+			UGSCGameFeatureAction_AddAbilities* Action = NewObject<UGSCGameFeatureAction_AddAbilities>(GetTransientPackage());
+
+			FGSCGameFeatureAbilityMapping AbilityMapping;
+			AbilityMapping.AbilityType = UGSCBenchmarkGameFeatureAbility::StaticClass();
+
+			FGSCGameFeatureAttributeSetMapping AttributeSetMapping;
+			AttributeSetMapping.AttributeSet = UGSCBenchmarkGameFeatureAttributeSet::StaticClass();
+
+			FGSCGameFeatureAbilitiesEntry Entry;
+			Entry.ActorClass = AGSCModularCharacter::StaticClass();
+			Entry.GrantedAbilities.Add(AbilityMapping);
+			Entry.GrantedAttributes.Add(AttributeSetMapping);
+			Action->AbilitiesList.Add(Entry);
+
+			// Go through UGameFeatureAction interface, the way the Game Features subsystem does
+			UGameFeatureAction* GameFeatureAction = Action;
+
+			const double Result = Measure(
+				Characters.Num(),
+				[GameFeatureAction]()
+				{
+					GameFeatureAction->OnGameFeatureActivating();
+				},
+				[GameFeatureAction]()
+				{
+					FGameFeatureDeactivatingContext Context{FSimpleDelegate()};
+					GameFeatureAction->OnGameFeatureDeactivating(Context);
+				}
+			);
+
+			// Activate once more outside of measurement, and check every spawned actor got its extensions
+			GameFeatureAction->OnGameFeatureActivating();
+
+			int32 NumMissingAbilities = 0;
+			int32 NumMissingAttributeSets = 0;
+			for (int32 Index = 0; Index < Characters.Num(); ++Index)
+			{
+				UGSCAbilitySystemComponent* ASC = GetASC(Index);
+				NumMissingAbilities += ASC->FindAbilitySpecFromClass(UGSCBenchmarkGameFeatureAbility::StaticClass()) ? 0 : 1;
+				NumMissingAttributeSets += ASC->GetSet<UGSCBenchmarkGameFeatureAttributeSet>() ? 0 : 1;
+			}
+
+			TestEqual(TEXT("Game feature ability granted to every actor"), NumMissingAbilities, 0);
+			TestEqual(TEXT("Game feature attribute set granted to every actor"), NumMissingAttributeSets, 0);
+
+			FGameFeatureDeactivatingContext Context{FSimpleDelegate()};
+			GameFeatureAction->OnGameFeatureDeactivating(Context);
+
+			TestNull(TEXT("Game feature ability removed on deactivation"), GetASC(0)->FindAbilitySpecFromClass(UGSCBenchmarkGameFeatureAbility::StaticClass()));
+			TestNull(TEXT("Game feature attribute set removed on deactivation"), GetASC(0)->GetSet<UGSCBenchmarkGameFeatureAttributeSet>());
+			ReportResult(TEXT("GameFeatureActivation"), Result);
+		});
+	});
+}
+
+void FGSCBenchmarksSpec::SetupWorld()
+{
+	GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->AddToRoot();
+	GameInstance->InitializeStandalone(TEXT("GSCBenchmarkWorld"));
+
+	World = GameInstance->GetWorld();
+	check(World);
+
+	const FURL URL;
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	Characters.Reset(NumActors);
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		Characters.Add(SpawnCharacter(Index, EGSCAbilitySystemProfile::Full));
+	}
+}
+
+AGSCModularCharacter* FGSCBenchmarksSpec::SpawnCharacter(const int32 Index, const EGSCAbilitySystemProfile Profile) const
+{
+	const FTransform SpawnTransform(FVector(200.f * (Index % 32), 200.f * (Index / 32), 100.f));
+	AGSCModularCharacter* Character = World->SpawnActorDeferred<AGSCModularCharacter>(
+		AGSCModularCharacter::StaticClass(),
+		SpawnTransform,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+
+	// Applied to the ASC on PreInitializeComponents
+	Character->AbilitySystemProfile = Profile;
+
+	// Granted on InitializeComponent, from InitAbilityActorInfo
+	FGSCAbilityInputMapping AbilityMapping;
+	AbilityMapping.Ability = UGSCBenchmarkAbility::StaticClass();
+
+	FGSCAttributeSetDefinition AttributeSetDefinition;
+	AttributeSetDefinition.AttributeSet = UGSCAttributeSet::StaticClass();
+
+	UGSCAbilitySystemComponent* ASC = Character->AbilitySystemComponent;
+	ASC->GrantedAbilities.Add(AbilityMapping);
+	ASC->GrantedAttributes.Add(AttributeSetDefinition);
+
+	Character->FinishSpawning(SpawnTransform);
+
+	UGSCCoreComponent* CoreComponent = NewObject<UGSCCoreComponent>(Character);
+	CoreComponent->RegisterComponent();
+	CoreComponent->SetupOwner();
+	CoreComponent->RegisterAbilitySystemDelegates(ASC);
+
+	ASC->SetNumericAttributeBase(UGSCAttributeSet::GetMaxHealthAttribute(), 1.e7f);
+	ASC->SetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute(), 1.e7f);
+	ASC->SetNumericAttributeBase(UGSCAttributeSet::GetMaxStaminaAttribute(), 1.e7f);
+	ASC->SetNumericAttributeBase(UGSCAttributeSet::GetStaminaAttribute(), 1.e7f);
+
+	return Character;
+}
+
+void FGSCBenchmarksSpec::DefineCrowdBenchmarks(const EGSCAbilitySystemProfile Profile)
+{
+	const FString ProfileName = StaticEnum<EGSCAbilitySystemProfile>()->GetNameStringByValue(static_cast<int64>(Profile));
+
+	// Reports Crowd against Full once both have been measured
+	const auto CompareProfiles = [this](const FString& BenchmarkName)
+	{
+		const double* FullResult = Results.Find(BenchmarkName + TEXT("_Full"));
+		const double* CrowdResult = Results.Find(BenchmarkName + TEXT("_Crowd"));
+		if (FullResult && CrowdResult && *FullResult > 0.0)
+		{
+			AddInfo(FString::Printf(TEXT("%s: Crowd profile %+.1f%% against Full profile"), *BenchmarkName, (*CrowdResult / *FullResult - 1.0) * 100.0));
+		}
+	};
+
+	It(FString::Printf(TEXT("spawns characters with %s profile"), *ProfileName), [this, Profile, ProfileName, CompareProfiles]()
+	{
+		TArray<AGSCModularCharacter*> CrowdCharacters;
+		CrowdCharacters.Reserve(NumCrowdActors);
+
+		const double Result = Measure(NumCrowdActors, [this, Profile, &CrowdCharacters]()
+		{
+			for (int32 Index = 0; Index < NumCrowdActors; ++Index)
+			{
+				CrowdCharacters.Add(SpawnCharacter(NumActors + Index, Profile));
+			}
+		}, [&CrowdCharacters]()
+		{
+			for (AGSCModularCharacter* Character : CrowdCharacters)
+			{
+				Character->Destroy();
+			}
+			CrowdCharacters.Reset();
+		});
+
+		ReportResult(TEXT("CrowdSpawn_") + ProfileName, Result);
+		CompareProfiles(TEXT("CrowdSpawn"));
+	});
+
+	It(FString::Printf(TEXT("activates abilities on characters with %s profile"), *ProfileName), [this, Profile, ProfileName, CompareProfiles]()
+	{
+		TArray<UGSCAbilitySystemComponent*> CrowdASCs;
+		for (int32 Index = 0; Index < NumCrowdActors; ++Index)
+		{
+			CrowdASCs.Add(SpawnCharacter(NumActors + Index, Profile)->AbilitySystemComponent);
+		}
+
+		int32 NumActivated = 0;
+		const double Result = Measure(CrowdASCs.Num(), [&CrowdASCs, &NumActivated]()
+		{
+			for (UGSCAbilitySystemComponent* ASC : CrowdASCs)
+			{
+				NumActivated += ASC->TryActivateAbilityByClass(UGSCBenchmarkAbility::StaticClass()) ? 1 : 0;
+			}
+		});
+
+		TestEqual(TEXT("All activations succeeded"), NumActivated, CrowdASCs.Num() * (NumIterations + 1));
+		ReportResult(TEXT("CrowdActivateAbility_") + ProfileName, Result);
+		CompareProfiles(TEXT("CrowdActivateAbility"));
+	});
+}
+
+void FGSCBenchmarksSpec::TeardownWorld()
+{
+	Characters.Reset();
+
+	if (World)
+	{
+		World->BeginTearingDown();
+	}
+
+	if (GameInstance)
+	{
+		GameInstance->Shutdown();
+	}
+
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+	}
+
+	if (GameInstance)
+	{
+		GameInstance->RemoveFromRoot();
+		GameInstance = nullptr;
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+UGSCBenchmarkAbility* FGSCBenchmarksSpec::GetBenchmarkAbility(const int32 Index) const
+{
+	const FGameplayAbilitySpec* AbilitySpec = GetASC(Index)->FindAbilitySpecFromClass(UGSCBenchmarkAbility::StaticClass());
+	return AbilitySpec ? Cast<UGSCBenchmarkAbility>(AbilitySpec->GetPrimaryInstance()) : nullptr;
+}
+
+double FGSCBenchmarksSpec::Measure(const int32 NumOps, const TFunctionRef<void()> Body, const TFunctionRef<void()> Reset) const
+{
+	// Warm up
+	Body();
+	Reset();
+
+	TArray<double> Samples;
+	Samples.Reserve(NumIterations);
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Body();
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+		Reset();
+
+		Samples.Add(ElapsedTime * 1.e6 / FMath::Max(NumOps, 1));
+	}
+
+	Samples.Sort();
+	return Samples[Samples.Num() / 2];
+}
+
+void FGSCBenchmarksSpec::ReportResult(const FString& Name, const double MicrosecondsPerOp)
+{
+	Results.Add(Name, MicrosecondsPerOp);
+	AddInfo(FString::Printf(TEXT("%s: %.3f us/op (%d actors, median of %d iterations)"), *Name, MicrosecondsPerOp, NumActors, NumIterations));
+
+	const TSharedRef<FJsonObject> ResultsJson = MakeResultsJson(Results, NumActors, NumIterations);
+	if (!WriteJson(ResultsJson, GetOutputPath()))
+	{
+		AddWarning(FString::Printf(TEXT("Failed to write benchmark results to %s"), *GetOutputPath()));
+	}
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("GSCBenchmarkWriteBaseline")))
+	{
+		WriteJson(ResultsJson, GetBaselinePath());
+		return;
+	}
+
+	FString BaselineString;
+	if (!FFileHelper::LoadFileToString(BaselineString, *GetBaselinePath()))
+	{
+		// Visible in CI reports, a missing baseline means regressions can't fail the run
+		AddWarning(FString::Printf(TEXT("No baseline found at %s, skipping comparison (run with -GSCBenchmarkWriteBaseline on a reference machine to create it)"), *GetBaselinePath()));
+		return;
+	}
+
+	TSharedPtr<FJsonObject> BaselineJson;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineString);
+	if (!FJsonSerializer::Deserialize(Reader, BaselineJson) || !BaselineJson.IsValid())
+	{
+		AddError(FString::Printf(TEXT("Failed to parse baseline %s"), *GetBaselinePath()));
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* BaselineResults = nullptr;
+	double BaselineValue = 0.0;
+	if (!BaselineJson->TryGetObjectField(TEXT("Results"), BaselineResults) || !(*BaselineResults)->TryGetNumberField(Name, BaselineValue))
+	{
+		AddInfo(FString::Printf(TEXT("%s: no baseline value, skipping comparison"), *Name));
+		return;
+	}
+
+	const double Ratio = BaselineValue > 0.0 ? MicrosecondsPerOp / BaselineValue : 1.0;
+	if (Ratio > 1.0 + Tolerance)
+	{
+		AddError(FString::Printf(TEXT("%s regressed: %.3f us/op against %.3f us/op baseline (%+.1f%%, tolerance %.1f%%)"), *Name, MicrosecondsPerOp, BaselineValue, (Ratio - 1.0) * 100.0, Tolerance * 100.f));
+	}
+	else
+	{
+		AddInfo(FString::Printf(TEXT("%s: %+.1f%% against baseline (%.3f us/op)"), *Name, (Ratio - 1.0) * 100.0, BaselineValue));
+	}
+}
+
+FString FGSCBenchmarksSpec::GetOutputPath() const
+{
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Automation/GASCompanion/Benchmarks.json");
+	FParse::Value(FCommandLine::Get(), TEXT("GSCBenchmarkOutput="), OutputPath);
+	return OutputPath;
+}
+
+FString FGSCBenchmarksSpec::GetBaselinePath() const
+{
+	FString BaselinePath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("GSCBenchmarkBaseline="), BaselinePath))
+	{
+		return BaselinePath;
+	}
+
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GASCompanion"));
+	return Plugin.IsValid() ? Plugin->GetBaseDir() / TEXT("Resources/Benchmarks/Baseline.json") : FString();
+}
+
+TSharedRef<FJsonObject> FGSCBenchmarksSpec::MakeResultsJson(const TMap<FString, double>& InResults, const int32 InNumActors, const int32 InNumIterations)
+{
+	const TSharedRef<FJsonObject> ResultsObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, double>& Result : InResults)
+	{
+		ResultsObject->SetNumberField(Result.Key, Result.Value);
+	}
+
+	const TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetStringField(TEXT("Unit"), TEXT("MicrosecondsPerOp"));
+	JsonObject->SetNumberField(TEXT("Actors"), InNumActors);
+	JsonObject->SetNumberField(TEXT("Iterations"), InNumIterations);
+	JsonObject->SetStringField(TEXT("Platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	JsonObject->SetStringField(TEXT("Configuration"), LexToString(FApp::GetBuildConfiguration()));
+	JsonObject->SetObjectField(TEXT("Results"), ResultsObject);
+	return JsonObject;
+}
+
+bool FGSCBenchmarksSpec::WriteJson(const TSharedRef<FJsonObject>& JsonObject, const FString& Filename)
+{
+	FString OutputString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	if (!FJsonSerializer::Serialize(JsonObject, Writer))
+	{
+		return false;
+	}
+
+	return !Filename.IsEmpty() && FFileHelper::SaveStringToFile(OutputString, *Filename);
+}